@@ -0,0 +1,100 @@
+#include "fpmas.h"
+#include "fpmas/utils/perf.h"
+
+/*
+ * Compares the EXACT and GROWABLE fpmas::io::datapack::AllocationMode when
+ * serializing an `std::vector<NodePtrWrapper<AgentPtr>>`, as performed by
+ * DistributedGraph::distribute() and GhostDataSync.
+ *
+ * @par usage
+ * ```
+ * objectpack-benchmark [node_count] [iterations]
+ * ```
+ */
+
+using namespace fpmas::io::datapack;
+using fpmas::graph::NodePtrWrapper;
+using fpmas::api::model::AgentPtr;
+
+class BenchmarkAgent : public fpmas::model::AgentBase<BenchmarkAgent> {
+	public:
+		std::string label;
+		std::vector<double> state;
+		std::set<fpmas::api::graph::DistributedId> contacts;
+
+		BenchmarkAgent() = default;
+		BenchmarkAgent(std::size_t i)
+			: label("agent-" + std::to_string(i)), state(8, (double) i) {
+				for(std::size_t j = 0; j < 4; j++)
+					contacts.insert({(int) j, (FPMAS_ID_TYPE) (i+j)});
+			}
+
+		static std::size_t size(const ObjectPack& p, const BenchmarkAgent* agent) {
+			return p.size(agent->label) + p.size(agent->state)
+				+ p.size(agent->contacts);
+		}
+
+		static void to_datapack(ObjectPack& p, const BenchmarkAgent* agent) {
+			p.put(agent->label);
+			p.put(agent->state);
+			p.put(agent->contacts);
+		}
+
+		static BenchmarkAgent* from_datapack(const ObjectPack& p) {
+			BenchmarkAgent* agent = new BenchmarkAgent;
+			agent->label = p.get<std::string>();
+			agent->state = p.get<std::vector<double>>();
+			agent->contacts = p.get<std::set<fpmas::api::graph::DistributedId>>();
+			return agent;
+		}
+};
+
+FPMAS_DATAPACK_SET_UP(BenchmarkAgent);
+
+int main(int argc, char** argv) {
+	fpmas::init(argc, argv);
+	FPMAS_REGISTER_AGENT_TYPES(BenchmarkAgent);
+	{
+		std::size_t node_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+		std::size_t iterations = argc > 2 ? std::stoul(argv[2]) : 10;
+
+		std::vector<NodePtrWrapper<AgentPtr>> nodes;
+		for(std::size_t i = 0; i < node_count; i++)
+			nodes.emplace_back(new fpmas::graph::DistributedNode<AgentPtr>(
+						{0, (FPMAS_ID_TYPE) i}, AgentPtr(new BenchmarkAgent(i))
+						));
+
+		fpmas::utils::perf::Monitor monitor;
+		fpmas::utils::perf::Probe exact_probe("EXACT");
+		fpmas::utils::perf::Probe growable_probe("GROWABLE");
+
+		std::size_t exact_size = 0;
+		std::size_t growable_size = 0;
+		for(std::size_t i = 0; i < iterations; i++) {
+			exact_probe.start();
+			exact_size = ObjectPack(nodes, EXACT).dump().size;
+			exact_probe.stop();
+
+			growable_probe.start();
+			growable_size = ObjectPack(nodes, GROWABLE).dump().size;
+			growable_probe.stop();
+		}
+		monitor.commit(exact_probe);
+		monitor.commit(growable_probe);
+
+		std::cout << "Serialization of " << node_count << " agent nodes ("
+			<< iterations << " iterations)" << std::endl;
+		for(auto mode : {
+				std::make_pair("EXACT", exact_size),
+				std::make_pair("GROWABLE", growable_size)}) {
+			std::cout << "  " << mode.first << ": "
+				<< std::chrono::duration_cast<std::chrono::microseconds>(
+						monitor.totalDuration(mode.first)).count() / iterations
+				<< " us/iteration, " << mode.second << " bytes" << std::endl;
+		}
+
+		for(auto node : nodes)
+			delete node.get();
+	}
+	fpmas::finalize();
+}
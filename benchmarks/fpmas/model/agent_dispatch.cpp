@@ -0,0 +1,115 @@
+#include "fpmas.h"
+#include "fpmas/utils/perf.h"
+
+/*
+ * Measures the cost of polymorphic AgentPtr ObjectPack serialization
+ * depending on the count of agent types handled by the
+ * fpmas::io::datapack::AgentPtrSerializer. Serialized agents always have the
+ * last type of the list, what corresponds to the worst case of a linear type
+ * lookup.
+ *
+ * @par usage
+ * ```
+ * agent-dispatch-benchmark [agent_count] [iterations]
+ * ```
+ */
+
+using namespace fpmas::io::datapack;
+using fpmas::api::model::AgentPtr;
+
+template<std::size_t I>
+class DispatchAgent : public fpmas::model::AgentBase<DispatchAgent<I>> {
+	public:
+		int field = 0;
+
+		DispatchAgent() = default;
+		DispatchAgent(int field) : field(field) {
+		}
+
+		static std::size_t size(const ObjectPack& p, const DispatchAgent* agent) {
+			return p.size(agent->field);
+		}
+
+		static void to_datapack(ObjectPack& p, const DispatchAgent* agent) {
+			p.put(agent->field);
+		}
+
+		static DispatchAgent* from_datapack(const ObjectPack& p) {
+			return new DispatchAgent(p.get<int>());
+		}
+};
+
+FPMAS_DEFAULT_DATAPACK_SET_UP();
+
+template<typename Sequence>
+struct Dispatch;
+
+/*
+ * Serialization helpers for the DispatchAgent<0>, ..., DispatchAgent<N-1>
+ * types.
+ */
+template<std::size_t... I>
+struct Dispatch<std::index_sequence<I...>> {
+	typedef AgentPtrSerializer<ObjectPack, DispatchAgent<I>..., void> PtrSerializer;
+	typedef DispatchAgent<sizeof...(I)-1> LastType;
+
+	static void register_types() {
+		fpmas::register_types<DispatchAgent<I>..., void>();
+	}
+
+	static std::size_t run(const std::vector<AgentPtr>& agents) {
+		ObjectPack pack;
+		std::size_t size = 0;
+		for(auto& agent : agents)
+			size += PtrSerializer::size(pack, agent);
+		pack.allocate(size);
+		for(auto& agent : agents)
+			PtrSerializer::to_datapack(pack, agent);
+		for(std::size_t i = 0; i < agents.size(); i++)
+			delete PtrSerializer::from_datapack(pack).get();
+		return size;
+	}
+};
+
+template<std::size_t N>
+void benchmark(
+		fpmas::utils::perf::Monitor& monitor,
+		std::size_t agent_count, std::size_t iterations) {
+	typedef Dispatch<std::make_index_sequence<N>> TypeList;
+
+	std::vector<AgentPtr> agents;
+	for(std::size_t i = 0; i < agent_count; i++)
+		agents.emplace_back(new typename TypeList::LastType(i));
+
+	std::string name = std::to_string(N) + " types";
+	fpmas::utils::perf::Probe probe(name);
+	for(std::size_t i = 0; i < iterations; i++) {
+		probe.start();
+		TypeList::run(agents);
+		probe.stop();
+	}
+	monitor.commit(probe);
+
+	std::cout << "  " << name << ": "
+		<< std::chrono::duration_cast<std::chrono::microseconds>(
+				monitor.totalDuration(name)).count() / iterations
+		<< " us/iteration" << std::endl;
+}
+
+int main(int argc, char** argv) {
+	fpmas::init(argc, argv);
+	Dispatch<std::make_index_sequence<50>>::register_types();
+	{
+		std::size_t agent_count = argc > 1 ? std::stoul(argv[1]) : 100000;
+		std::size_t iterations = argc > 2 ? std::stoul(argv[2]) : 10;
+
+		std::cout << "Serialization and unserialization of " << agent_count
+			<< " agents (" << iterations << " iterations)" << std::endl;
+
+		fpmas::utils::perf::Monitor monitor;
+		benchmark<1>(monitor, agent_count, iterations);
+		benchmark<10>(monitor, agent_count, iterations);
+		benchmark<50>(monitor, agent_count, iterations);
+	}
+	fpmas::finalize();
+}
@@ -0,0 +1,82 @@
+#include "fpmas.h"
+#include "fpmas/utils/perf.h"
+
+/*
+ * Measures the cost of one DistributedMoveAlgorithm execution on a large
+ * MooreGrid, where each agent moves to a random cell of its mobility field.
+ * The behavior execution is not included in the measure.
+ *
+ * @par usage
+ * ```
+ * [mpiexec -n <N>] move-algorithm-benchmark [grid_size] [iterations]
+ * ```
+ */
+
+class MovingAgent : public fpmas::model::GridAgent<MovingAgent> {
+	public:
+		static fpmas::model::MooreRange<fpmas::model::MooreGrid<>> range;
+
+		FPMAS_MOBILITY_RANGE(range);
+		FPMAS_PERCEPTION_RANGE(range);
+
+		void move() {
+			this->moveTo(this->mobilityField().random());
+		}
+};
+
+fpmas::model::MooreRange<fpmas::model::MooreGrid<>> MovingAgent::range(1);
+
+FPMAS_DEFAULT_JSON(MovingAgent)
+FPMAS_DEFAULT_DATAPACK(MovingAgent)
+
+FPMAS_JSON_SET_UP(fpmas::model::GridCell::JsonBase, MovingAgent::JsonBase)
+
+int main(int argc, char** argv) {
+	FPMAS_REGISTER_AGENT_TYPES(fpmas::model::GridCell::JsonBase, MovingAgent::JsonBase);
+	fpmas::init(argc, argv);
+	{
+		fpmas::model::DiscreteCoordinate grid_size
+			= argc > 1 ? std::stol(argv[1]) : 1000;
+		std::size_t iterations = argc > 2 ? std::stoul(argv[2]) : 5;
+
+		fpmas::model::GridModel<fpmas::synchro::GhostMode> model;
+		fpmas::model::MooreGridBuilder<> grid_builder(grid_size, grid_size);
+		fpmas::model::Behavior<MovingAgent> behavior(&MovingAgent::move);
+		auto& group = model.buildMoveGroup(0, behavior);
+
+		fpmas::utils::perf::Monitor monitor;
+		fpmas::utils::perf::Probe build_probe("build");
+		build_probe.start();
+		grid_builder.build(model);
+		fpmas::model::UniformGridAgentMapping mapping(
+				grid_size, grid_size, grid_size*grid_size/10);
+		fpmas::model::GridAgentBuilder<>().build(
+				model, {group}, [] () {return new MovingAgent;}, mapping);
+		build_probe.stop();
+		monitor.commit(build_probe);
+
+		fpmas::utils::perf::Probe probe("move");
+		for(std::size_t i = 0; i < iterations; i++) {
+			// Behaviors are not measured
+			model.runtime().execute(group.agentExecutionJob());
+			probe.start();
+			model.runtime().execute(group.distributedMoveAlgorithm().jobs());
+			probe.stop();
+		}
+		monitor.commit(probe);
+
+		if(model.getMpiCommunicator().getRank() == 0) {
+			std::cout << "Grid " << grid_size << "x" << grid_size << ", "
+				<< grid_size*grid_size/10 << " agents, "
+				<< model.getMpiCommunicator().getSize() << " processes" << std::endl;
+			std::cout << "  build: " << std::chrono::duration_cast<std::chrono::milliseconds>(
+					monitor.totalDuration("build")).count()
+				<< " ms" << std::endl;
+			std::cout << "  move algorithm: "
+				<< std::chrono::duration_cast<std::chrono::milliseconds>(
+						monitor.totalDuration("move")).count() / iterations
+				<< " ms/iteration" << std::endl;
+		}
+	}
+	fpmas::finalize();
+}
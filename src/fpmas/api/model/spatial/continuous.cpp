@@ -0,0 +1,28 @@
+#include "continuous.h"
+#include <cmath>
+
+namespace fpmas {
+	std::string to_string(const api::model::ContinuousPoint& point) {
+		return "(" + std::to_string(point.x) + "," + std::to_string(point.y) + ")";
+	}
+
+	namespace api { namespace model {
+
+		ContinuousCoordinate euclidian_distance(
+				const ContinuousPoint& p1, const ContinuousPoint& p2) {
+			return std::sqrt(std::pow(p2.y - p1.y, 2) + std::pow(p2.x - p1.x, 2));
+		}
+
+		bool operator==(const ContinuousPoint& p1, const ContinuousPoint& p2) {
+			return p1.x == p2.x && p1.y == p2.y;
+		}
+
+		bool operator!=(const ContinuousPoint& p1, const ContinuousPoint& p2) {
+			return p1.x != p2.x || p1.y != p2.y;
+		}
+
+		std::ostream& operator<<(std::ostream& os, const ContinuousPoint& point) {
+			return os << to_string(point);
+		}
+	}}
+}
@@ -0,0 +1,133 @@
+#ifndef FPMAS_CONTINUOUS_API_H
+#define FPMAS_CONTINUOUS_API_H
+
+/** \file src/fpmas/api/model/spatial/continuous.h
+ * Continuous space models API.
+ */
+
+#include "grid.h"
+
+namespace fpmas { namespace api { namespace model {
+
+	/**
+	 * Real coordinate type.
+	 */
+	typedef double ContinuousCoordinate;
+
+	/**
+	 * A structure representing a 2D continuous point (i.e. with real
+	 * coordinates).
+	 */
+	struct ContinuousPoint {
+		/**
+		 * X coordinate.
+		 */
+		ContinuousCoordinate x;
+		/**
+		 * Y coordinate.
+		 */
+		ContinuousCoordinate y;
+
+		/**
+		 * Default constructor.
+		 *
+		 * Coordinates are default initialized.
+		 */
+		ContinuousPoint() {}
+		/**
+		 * ContinuousPoint constructor.
+		 *
+		 * @param x X coordinate
+		 * @param y Y coordinate
+		 */
+		ContinuousPoint(ContinuousCoordinate x, ContinuousCoordinate y)
+			: x(x), y(y) {}
+	};
+
+	/**
+	 * Computes the euclidian distance between `p1` and `p2`.
+	 */
+	ContinuousCoordinate euclidian_distance(
+			const ContinuousPoint& p1, const ContinuousPoint& p2);
+
+	/**
+	 * Checks the equality of two ContinuousPoints.
+	 *
+	 * `p1` and `p2` are equals if and only if their two coordinates are equal.
+	 *
+	 * @return true iff `p1` and `p2` are equal
+	 */
+	bool operator==(const ContinuousPoint& p1, const ContinuousPoint& p2);
+	/**
+	 * Equivalent to `!(p1==p2)`.
+	 */
+	bool operator!=(const ContinuousPoint& p1, const ContinuousPoint& p2);
+
+	/**
+	 * A non-templated base class for agents situated with real coordinates.
+	 *
+	 * In a continuous space, the environment is still represented as a
+	 * network of \GridCells, each GridCell representing a square _bin_ of
+	 * the space. A ContinuousAgent is located on the bin that contains its
+	 * position(), so that the SpatialAgent API (mobility field, perception
+	 * field, perceptions...) can still be used to find bins and agents around
+	 * it.
+	 *
+	 * This notably allows the usage of moveTo(ContinuousPoint) and position()
+	 * methods from a `dynamic_cast` from the api::model::Agent base, without
+	 * the need for the `CellType` template parameter.
+	 */
+	class ContinuousAgentBase {
+		protected:
+			/**
+			 * Moves to the specified position.
+			 *
+			 * If the bin containing `point` is the current location of the
+			 * agent, only its position is updated. Otherwise, the agent moves
+			 * to the corresponding GridCell as with
+			 * GridAgentBase::moveTo(DiscretePoint), so that an
+			 * OutOfMobilityFieldException is thrown if this GridCell is not
+			 * contained in the current _mobility field_.
+			 *
+			 * @param point continuous coordinates
+			 * @throw OutOfMobilityFieldException
+			 */
+			virtual void moveTo(ContinuousPoint point) = 0;
+
+		public:
+			/**
+			 * Returns the current position of the agent as continuous
+			 * coordinates.
+			 *
+			 * Contrary to SpatialAgent::locationCell(), the position of
+			 * DISTANT agents is available, as any other agent data.
+			 *
+			 * @return position of the agent
+			 */
+			virtual ContinuousPoint position() const = 0;
+
+			virtual ~ContinuousAgentBase() {}
+	};
+}}}
+
+namespace fpmas {
+	/**
+	 * ContinuousPoint string conversion.
+	 *
+	 * @param point point to convert
+	 * @return string representation of the point
+	 */
+	std::string to_string(const api::model::ContinuousPoint& point);
+
+	namespace api { namespace model {
+		/**
+		 * ContinuousPoint stream output operator.
+		 *
+		 * @param os output stream
+		 * @param point point to insert
+		 * @return os
+		 */
+		std::ostream& operator<<(std::ostream& os, const ContinuousPoint& point);
+	}}
+}
+#endif
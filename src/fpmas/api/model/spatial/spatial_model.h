@@ -25,6 +25,28 @@ namespace fpmas { namespace api { namespace model {
 		NEW_PERCEIVE = -8
 	};
 
+	/**
+	 * Defines how the perceptions of a SpatialAgent are made available.
+	 */
+	enum PerceptionMode {
+		/**
+		 * Perceptions are materialized as edges on the PERCEPTION layer,
+		 * built by \Cells at the end of each DistributedMoveAlgorithm
+		 * execution. This is the default mode.
+		 */
+		LINKED_PERCEPTIONS,
+		/**
+		 * Perceptions are queried on demand from the LOCATION layer of the
+		 * \Cells contained in the perception field of the SpatialAgent.
+		 *
+		 * PERCEPTION edges are only built for \Cells that are not LOCAL to
+		 * the process of the SpatialAgent, since the LOCATION links of
+		 * agents located in such \Cells are not necessarily represented on
+		 * the current process.
+		 */
+		QUERIED_PERCEPTIONS
+	};
+
 	/**
 	 * Predefined Cell behaviors specifically used in the context of the
 	 * DistributedMoveAlgorithm.
@@ -71,6 +93,10 @@ namespace fpmas { namespace api { namespace model {
 			 * More precisely, each agent connected to this Cell on the
 			 * PERCEIVE layer is linked to all agents located in this Cell,
 			 * (i.e. connected on the LOCATION layer) on the PERCEPTION layer.
+			 *
+			 * Agents using the QUERIED_PERCEPTIONS mode are not linked if they
+			 * are LOCAL, since they can directly query the LOCATION layer of
+			 * this Cell.
 			 */
 			virtual void updatePerceptions(AgentGroup& group) = 0;
 
@@ -223,7 +249,9 @@ namespace fpmas { namespace api { namespace model {
 	 * neighbors of type Cell on the `MOVE` layer.
 	 *
 	 * The _perceptions_ of a SpatialAgent are defined as elements of the set
-	 * of outgoind neighbors of type Agent on the `PERCEPTION` layer.
+	 * of outgoind neighbors of type Agent on the `PERCEPTION` layer, or as the
+	 * agents located in its perception field, depending on its
+	 * perceptionMode().
 	 *
 	 * Helper functions might be defined in implementing classes to access
 	 * those elements.
@@ -326,6 +354,17 @@ namespace fpmas { namespace api { namespace model {
 			 */
 			virtual const Range<CellType>& perceptionRange() const = 0;
 
+			/**
+			 * Returns the PerceptionMode of this SpatialAgent.
+			 *
+			 * The PerceptionMode is assumed to be constant for a given
+			 * SpatialAgent, since it determines how \Cells update its
+			 * perceptions.
+			 *
+			 * @return perception mode
+			 */
+			virtual PerceptionMode perceptionMode() const = 0;
+
 		protected:
 			/**
 			 * Moves to the Cell with the provided `id`.
@@ -418,10 +418,15 @@ namespace fpmas { namespace communication {
 				std::unordered_map<int, DataPack> import_data_pack;
 
 				{
-					// Pack
+					// Pack. Vectors are serialized in a single pass, since
+					// computing their size might be as costly as the
+					// serialization itself.
 					std::unordered_map<int, DataPack> export_data_pack;
 					for(auto& item : export_map)
-						export_data_pack.emplace(item.first, PackType(item.second).dump());
+						export_data_pack.emplace(
+								item.first,
+								PackType(item.second, io::datapack::GROWABLE).dump()
+								);
 
 					// export_data_pack buffers are moved to the temporary allToAll
 					// argument, and automatically freed by the allToAll
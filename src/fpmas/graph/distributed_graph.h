@@ -732,7 +732,9 @@ namespace fpmas { namespace graph {
 					for(auto& item : node_export_map)
 						serial_nodes.emplace(
 								item.first,
-								io::datapack::ObjectPack(item.second).dump()
+								io::datapack::ObjectPack(
+									item.second, io::datapack::GROWABLE
+									).dump()
 								);
 					for(auto& item : edge_export_map)
 						serial_edges.emplace(
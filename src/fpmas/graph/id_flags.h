@@ -0,0 +1,134 @@
+#ifndef FPMAS_ID_FLAGS_H
+#define FPMAS_ID_FLAGS_H
+
+/** \file src/fpmas/graph/id_flags.h
+ * IdFlags implementation.
+ */
+
+#include "fpmas/api/graph/distributed_id.h"
+#include <vector>
+
+namespace fpmas { namespace graph {
+	using api::graph::DistributedId;
+
+	/**
+	 * A flat set of \DistributedIds, optimized to be filled and cleared many
+	 * times.
+	 *
+	 * Ids are stored in an open addressing hash table with linear probing.
+	 * Each slot is stamped with the _epoch_ at which it was filled, so that
+	 * clear() is performed in constant time, only incrementing the current
+	 * epoch, and the allocated table is reused by the next insertions.
+	 *
+	 * In consequence, the memory is only allocated when the set grows larger
+	 * than it ever was, and is never released until the set is destroyed.
+	 * Ids can't be removed individually.
+	 */
+	class IdFlags {
+		private:
+			struct Slot {
+				DistributedId id;
+				std::size_t epoch = 0;
+			};
+
+			std::vector<Slot> slots;
+			std::size_t epoch = 1;
+			std::size_t _size = 0;
+
+			std::size_t index(const DistributedId& id) const {
+				// Fibonacci hashing of the rank and the local id, since
+				// std::hash<DistributedId> does not take the rank into account
+				std::size_t hash = (std::size_t) id.id() * 0x9e3779b97f4a7c15ull
+					^ (std::size_t) id.rank() * 0xc2b2ae3d27d4eb4full;
+				return (hash ^ (hash >> 29)) & (slots.size() - 1);
+			}
+
+			void grow() {
+				std::vector<Slot> old_slots(
+						slots.empty() ? 16 : 2*slots.size());
+				std::swap(slots, old_slots);
+				std::size_t old_epoch = epoch;
+				epoch = 1;
+				_size = 0;
+				for(auto& slot : old_slots)
+					if(slot.epoch == old_epoch)
+						insert(slot.id);
+			}
+
+		public:
+			/**
+			 * Returns true iff `id` is contained in the set.
+			 *
+			 * @param id id to search
+			 */
+			bool contains(const DistributedId& id) const {
+				if(_size == 0)
+					return false;
+				std::size_t i = index(id);
+				while(slots[i].epoch == epoch) {
+					if(slots[i].id == id)
+						return true;
+					i = (i+1) & (slots.size() - 1);
+				}
+				return false;
+			}
+
+			/**
+			 * Returns 1 if `id` is contained in the set, 0 otherwise.
+			 *
+			 * Provided for compatibility with std::set.
+			 *
+			 * @param id id to search
+			 */
+			std::size_t count(const DistributedId& id) const {
+				return contains(id) ? 1 : 0;
+			}
+
+			/**
+			 * Inserts `id` in the set.
+			 *
+			 * @param id id to insert
+			 * @return true iff `id` was not already contained in the set
+			 */
+			bool insert(const DistributedId& id) {
+				// Maximum load factor of 1/2
+				if(2*(_size+1) > slots.size())
+					grow();
+				std::size_t i = index(id);
+				while(slots[i].epoch == epoch) {
+					if(slots[i].id == id)
+						return false;
+					i = (i+1) & (slots.size() - 1);
+				}
+				slots[i].id = id;
+				slots[i].epoch = epoch;
+				_size++;
+				return true;
+			}
+
+			/**
+			 * Removes all ids from the set, in constant time.
+			 *
+			 * The allocated memory is preserved.
+			 */
+			void clear() {
+				_size = 0;
+				epoch++;
+			}
+
+			/**
+			 * Count of ids in the set.
+			 */
+			std::size_t size() const {
+				return _size;
+			}
+
+			/**
+			 * Returns true iff the set does not contain any id.
+			 */
+			bool empty() const {
+				return _size == 0;
+			}
+	};
+}}
+#endif
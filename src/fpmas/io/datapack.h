@@ -5,6 +5,7 @@
  * Binary DataPack based serialization features.
  */
 
+#include <algorithm>
 #include <string>
 #include <set>
 #include <list>
@@ -55,6 +56,78 @@ namespace fpmas { namespace io { namespace datapack {
 		struct Serializer {
 		};
 
+	/**
+	 * Trait used to enable bulk serialization of containers of T.
+	 *
+	 * When `is_trivially_serializable<T>::value` is true, instances of T
+	 * are serialized as their raw binary representation, so that
+	 * `std::vector<T>` and `std::array<T, N>` instances are written and
+	 * read using a single `std::memcpy` operation, and `std::deque<T>`
+	 * items are copied without any Serializer dispatch.
+	 *
+	 * By default, only arithmetic types are trivially serializable. Custom
+	 * trivially copyable types, such as POD agent state structures, can opt
+	 * in specializing this trait:
+	 * ```cpp
+	 * struct State {
+	 * 	double x;
+	 * 	double y;
+	 * };
+	 *
+	 * namespace fpmas { namespace io { namespace datapack {
+	 * 	template<>
+	 * 	struct is_trivially_serializable<State> : public std::true_type {
+	 * 	};
+	 * }}}
+	 * ```
+	 *
+	 * A raw binary Serializer is then implicitly available for T, unless an
+	 * explicit Serializer<T> specialization is defined. The serialized data
+	 * can only be read back on architectures with the same T representation.
+	 *
+	 * Padding bytes of T are also copied, what increases the size of
+	 * serialized data and sends uninitialized bytes over MPI. Only types
+	 * without padding, i.e. such that `sizeof(T)` is equal to the sum of the
+	 * sizes of their fields, should opt in. This is notably why
+	 * api::graph::DistributedId is **not** trivially serializable.
+	 *
+	 * @tparam T data type
+	 */
+	template<typename T>
+		struct is_trivially_serializable : public std::is_arithmetic<T> {
+		};
+
+	/**
+	 * True iff `std::vector<T>` and `std::array<T, N>` can be serialized
+	 * with a single `std::memcpy` operation. `std::vector<bool>` is
+	 * excluded since its items are not stored contiguously.
+	 *
+	 * @tparam T data type
+	 */
+	template<typename T>
+		struct is_bulk_serializable : public std::integral_constant<bool,
+		is_trivially_serializable<T>::value && !std::is_same<T, bool>::value> {
+		};
+
+	/**
+	 * Allocation strategies that can be used to serialize data into a
+	 * BasicObjectPack.
+	 */
+	enum AllocationMode {
+		/**
+		 * The required buffer size is first computed using the `S<T>::size()`
+		 * specializations, so that the buffer can be allocated in a single
+		 * operation before data is serialized. This is the default mode.
+		 */
+		EXACT,
+		/**
+		 * Data is serialized in a single pass: the buffer is automatically
+		 * and geometrically expanded by write() operations, so that
+		 * `S<T>::size()` specializations are never called.
+		 */
+		GROWABLE
+	};
+
 	/**
 	 * Base object used to implement the FPMAS binary serialization
 	 * technique.
@@ -247,6 +320,31 @@ namespace fpmas { namespace io { namespace datapack {
 	 * performs a **single** contiguous memory allocation, thanks to
 	 * the `size()` method trick.
 	 *
+	 * @section growable_mode Single pass serialization
+	 *
+	 * Computing the exact buffer size requires to walk the whole object
+	 * graph once with `size()` before walking it again with `to_datapack()`.
+	 * For large and complex objects (such as lists of serialized \Agents),
+	 * this first pass might be as costly as the serialization itself.
+	 *
+	 * The GROWABLE AllocationMode can be used instead to serialize data in a
+	 * single pass, without calling any `size()` method. In this mode, the
+	 * internal buffer is geometrically expanded by write() operations as
+	 * needed, and finally shrunk to the actual count of written bytes.
+	 *
+	 * ```cpp
+	 * std::vector<std::string> data {"hello", "world"};
+	 * ObjectPack pack(data, GROWABLE);
+	 *
+	 * // Equivalent to
+	 * ObjectPack pack;
+	 * pack.reserve(64);
+	 * pack.put(data);
+	 * pack.shrink();
+	 * ```
+	 *
+	 * Both modes produce exactly the same data.
+	 *
 	 * @section write_and_read write() and read() operations
 	 *
 	 * An read() / write() serialization technique can be used for types that
@@ -306,8 +404,27 @@ namespace fpmas { namespace io { namespace datapack {
 			DataPack _data {0, 1};
 			std::size_t write_offset = 0;
 			mutable std::size_t read_offset = 0;
+			AllocationMode allocation_mode = EXACT;
+
+			/*
+			 * Ensures that `count` bytes are available from the current
+			 * write_offset, geometrically expanding the buffer if
+			 * required.
+			 */
+			void grow(std::size_t count) {
+				std::size_t required_size = write_offset + count;
+				if(required_size > _data.size)
+					_data.resize(std::max(required_size, 2*_data.size));
+			}
 
 			public:
+			/**
+			 * Initial buffer capacity used by the
+			 * BasicObjectPack(const T&, AllocationMode) constructor in
+			 * GROWABLE mode.
+			 */
+			static const std::size_t DEFAULT_CAPACITY = 64;
+
 			BasicObjectPack() = default;
 
 			/**
@@ -329,6 +446,41 @@ namespace fpmas { namespace io { namespace datapack {
 					write_offset+=count;
 				}
 
+			/**
+			 * Serializes item in a new BasicObjectPack, using the
+			 * specified AllocationMode.
+			 *
+			 * In EXACT mode, the BasicObjectPack is allocated in a single
+			 * operation, calling `allocate(S<T>::%size(*this, item))`.
+			 *
+			 * In GROWABLE mode, item is serialized in a single pass from
+			 * an initial buffer of DEFAULT_CAPACITY bytes, and
+			 * `S<T>::%size()` is **not** called. The buffer is finally
+			 * shrunk to the count of written bytes, so that data() is
+			 * the same in both modes.
+			 *
+			 * In both cases, the data is serialized into the
+			 * BasicObjectPack using the
+			 * S<T>::to_datapack(BasicObjectPack<S>&, const T&)
+			 * specialization.
+			 *
+			 * @param item item to serialize
+			 * @param mode allocation mode
+			 */
+			template<typename T>
+				BasicObjectPack(const T& item, AllocationMode mode) {
+					switch(mode) {
+						case EXACT:
+							this->allocate(S<T>::size(*this, item));
+							S<T>::to_datapack(*this, item);
+							break;
+						case GROWABLE:
+							this->reserve(DEFAULT_CAPACITY);
+							S<T>::to_datapack(*this, item);
+							this->shrink();
+					}
+				}
+
 			/**
 			 * Serializes item in the current BasicObjectPack.
 			 *
@@ -469,6 +621,48 @@ namespace fpmas { namespace io { namespace datapack {
 			 */
 			void allocate(std::size_t size) {
 				_data = {size, 1};
+				allocation_mode = EXACT;
+			}
+
+			/**
+			 * Allocates `capacity` bytes in the internal DataPack buffer
+			 * and switches the BasicObjectPack to the GROWABLE mode.
+			 *
+			 * In this mode, the buffer is automatically expanded by
+			 * write() operations, so that no size has to be computed
+			 * before put() calls. The buffer capacity is at least doubled
+			 * each time it is expanded, so that the amortized cost of
+			 * each write() remains constant.
+			 *
+			 * Notice that in this mode, `data().size` is the current
+			 * buffer capacity, until shrink() or dump() is called.
+			 *
+			 * @param capacity initial buffer capacity
+			 */
+			void reserve(std::size_t capacity) {
+				_data = {capacity, 1};
+				allocation_mode = GROWABLE;
+			}
+
+			/**
+			 * Resizes the internal buffer to the current writeOffset(), so
+			 * that unused capacity allocated in GROWABLE mode is released.
+			 *
+			 * Has no effect in EXACT mode.
+			 */
+			void shrink() {
+				if(allocation_mode == GROWABLE)
+					_data.resize(write_offset);
+			}
+
+			/**
+			 * Returns the current allocation mode, as specified by the
+			 * last allocate() (EXACT) or reserve() (GROWABLE) call.
+			 *
+			 * @return current allocation mode
+			 */
+			AllocationMode allocationMode() const {
+				return allocation_mode;
 			}
 
 			/**
@@ -498,11 +692,17 @@ namespace fpmas { namespace io { namespace datapack {
 			 * pack.put(i0);
 			 * ```
 			 *
+			 * In GROWABLE mode, this only ensures that `size` bytes are
+			 * available from the current writeOffset().
+			 *
 			 * @param size size to allocate in addition to the current buffer
 			 * size
 			 */
 			void expand(std::size_t size) {
-				_data.resize(_data.size + size);
+				if(allocation_mode == GROWABLE)
+					grow(size);
+				else
+					_data.resize(_data.size + size);
 			}
 
 			/**
@@ -515,11 +715,15 @@ namespace fpmas { namespace io { namespace datapack {
 			 * `std::memcpy` operation, and the internal writeOffset() is
 			 * incremented by `sizeof(T)`.
 			 *
+			 * In GROWABLE mode, the buffer is expanded if required.
+			 *
 			 * @param item item to write
 			 */
 			template<typename T>
 				void write(const T& item) {
 					std::size_t count = sizeof(T);
+					if(allocation_mode == GROWABLE)
+						grow(count);
 					std::memcpy(&_data.buffer[write_offset], &item, count);
 					write_offset+=count;
 				}
@@ -535,10 +739,14 @@ namespace fpmas { namespace io { namespace datapack {
 			 * operation, and the internal writeOffset() is incremented by
 			 * `count`.
 			 *
+			 * In GROWABLE mode, the buffer is expanded if required.
+			 *
 			 * @param input_data input buffer to copy data from
 			 * @param count count of bytes to copy
 			 */
 			void write(const void* input_data, std::size_t count) {
+					if(allocation_mode == GROWABLE)
+						grow(count);
 					std::memcpy(&_data.buffer[write_offset], input_data, count);
 					write_offset+=count;
 			}
@@ -613,9 +821,13 @@ namespace fpmas { namespace io { namespace datapack {
 			 *
 			 * The current BasicObjectPack is left empty.
 			 *
+			 * In GROWABLE mode, the buffer is shrunk before being
+			 * returned.
+			 *
 			 * @return internal DataPack buffer
 			 */
 			DataPack dump() {
+				shrink();
 				write_offset = 0;
 				read_offset = 0;
 				return std::move(_data);
@@ -711,9 +923,12 @@ namespace fpmas { namespace io { namespace datapack {
 			template<typename PackType>
 				static void to_datapack(
 						PackType& parent, const BasicObjectPack<S>& child) {
-					parent.write(child._data.size);
-					parent.expand(child._data.size);
-					parent.write(child._data.buffer, child._data.size);
+					// Unused capacity of a GROWABLE child is not written
+					std::size_t size = child.allocation_mode == GROWABLE ?
+						child.write_offset : child._data.size;
+					parent.write(size);
+					parent.expand(size);
+					parent.write(child._data.buffer, size);
 				}
 
 			/**
@@ -737,16 +952,20 @@ namespace fpmas { namespace io { namespace datapack {
 		};
 
 	/**
-	 * Serializer implementation only available for fundamental types.
+	 * Serializer implementation only available for fundamental and
+	 * is_trivially_serializable types.
 	 *
 	 * | Serialization Scheme |
 	 * |----------------------|
 	 * | raw binary value     |
 	 *
 	 * @tparam T fundamental type (std::size_t, std::int32_t, unsigned int...)
+	 * or is_trivially_serializable type
 	 */
 	template<typename T>
-		struct Serializer<T, typename std::enable_if<std::is_fundamental<T>::value>::type> {
+		struct Serializer<T, typename std::enable_if<
+		std::is_fundamental<T>::value || is_trivially_serializable<T>::value
+		>::type> {
 			/**
 			 * Returns the buffer size required to serialize an instance of T.
 			 *
@@ -851,7 +1070,8 @@ namespace fpmas { namespace io { namespace datapack {
 	 * | vec.size() | item_1 | item_2 | ... | item_n |
 	 */
 	template<typename T>
-		struct Serializer<std::vector<T>> {
+		struct Serializer<std::vector<T>,
+		typename std::enable_if<!is_bulk_serializable<T>::value>::type> {
 			/**
 			 * Returns the buffer size required to serialize `vec` into `p`.
 			 */
@@ -899,6 +1119,62 @@ namespace fpmas { namespace io { namespace datapack {
 				}
 		};
 
+	/**
+	 * std::vector Serializer specialization for is_bulk_serializable types.
+	 *
+	 * The serialization scheme is the same as the regular std::vector
+	 * Serializer, but items are written and read using a single
+	 * `std::memcpy` operation.
+	 *
+	 * | Serialization Scheme ||
+	 * |----------------------||
+	 * | vec.size() | vec.data() (T array) |
+	 */
+	template<typename T>
+		struct Serializer<std::vector<T>,
+		typename std::enable_if<is_bulk_serializable<T>::value>::type> {
+			static_assert(std::is_trivially_copyable<T>::value,
+					"is_trivially_serializable types must be trivially copyable");
+
+			/**
+			 * Returns the buffer size required to serialize `vec` into `p`,
+			 * i.e. `p.size<std::size_t>() + vec.size()*sizeof(T)`.
+			 */
+			template<typename PackType>
+				static std::size_t size(const PackType& p, const std::vector<T>& vec) {
+					return p.template size<std::size_t>() + vec.size()*sizeof(T);
+				}
+
+			/**
+			 * Serializes `vec` to `pack`.
+			 *
+			 * @param pack destination BasicObjectPack
+			 * @param vec vector to serialize
+			 */
+			template<typename PackType>
+				static void to_datapack(PackType& pack, const std::vector<T>& vec) {
+					pack.template put(vec.size());
+					// vec.data() might be null if vec is empty
+					if(vec.size() > 0)
+						pack.write(vec.data(), vec.size()*sizeof(T));
+				}
+
+			/**
+			 * Unserializes a vector from `pack`.
+			 *
+			 * @param pack source BasicObjectPack
+			 * @return unserialized vector
+			 */
+			template<typename PackType>
+				static std::vector<T> from_datapack(const PackType& pack) {
+					std::size_t size = pack.template get<std::size_t>();
+					std::vector<T> data(size);
+					if(size > 0)
+						pack.read(data.data(), size*sizeof(T));
+					return data;
+				}
+		};
+
 
 	/**
 	 * std::set Serializer specialization.
@@ -1034,7 +1310,8 @@ namespace fpmas { namespace io { namespace datapack {
 	 * | deque.size() | item_1 | item_2 | ... | item_n |
 	 */
 	template<typename T>
-		struct Serializer<std::deque<T>> {
+		struct Serializer<std::deque<T>,
+		typename std::enable_if<!is_trivially_serializable<T>::value>::type> {
 			/**
 			 * Returns the buffer size required to serialize `deque` into `p`.
 			 */
@@ -1083,6 +1360,62 @@ namespace fpmas { namespace io { namespace datapack {
 				}
 		};
 
+	/**
+	 * std::deque Serializer specialization for is_trivially_serializable
+	 * types.
+	 *
+	 * Since items of an std::deque are not stored contiguously, each item is
+	 * still copied independently, but using raw `write()` and `read()`
+	 * operations so that no Serializer is involved.
+	 *
+	 * | Serialization scheme |||||
+	 * |----------------------|||||
+	 * | deque.size() | item_1 | item_2 | ... | item_n |
+	 */
+	template<typename T>
+		struct Serializer<std::deque<T>,
+		typename std::enable_if<is_trivially_serializable<T>::value>::type> {
+			static_assert(std::is_trivially_copyable<T>::value,
+					"is_trivially_serializable types must be trivially copyable");
+
+			/**
+			 * Returns the buffer size required to serialize `deque` into `p`,
+			 * i.e. `p.size<std::size_t>() + deque.size()*sizeof(T)`.
+			 */
+			template<typename PackType>
+				static std::size_t size(const PackType& p, const std::deque<T>& deque) {
+					return p.template size<std::size_t>() + deque.size()*sizeof(T);
+				}
+
+			/**
+			 * Serializes `deque` to `pack`.
+			 *
+			 * @param pack destination BasicObjectPack
+			 * @param deque deque to serialize
+			 */
+			template<typename PackType>
+				static void to_datapack(PackType& pack, const std::deque<T>& deque) {
+					pack.template put(deque.size());
+					for(const T& item : deque)
+						pack.write(item);
+				}
+
+			/**
+			 * Unserializes a deque from `pack`.
+			 *
+			 * @param pack source BasicObjectPack
+			 * @return unserialized deque
+			 */
+			template<typename PackType>
+				static std::deque<T> from_datapack(const PackType& pack) {
+					std::size_t size = pack.template get<std::size_t>();
+					std::deque<T> deque(size);
+					for(T& item : deque)
+						pack.read(item);
+					return deque;
+				}
+		};
+
 	/**
 	 * std::pair Serializer specialization.
 	 *
@@ -1285,7 +1618,8 @@ namespace fpmas { namespace io { namespace datapack {
 	 * @tparam N array size
 	 */
 	template<typename T, std::size_t N>
-		struct Serializer<std::array<T, N>> {
+		struct Serializer<std::array<T, N>,
+		typename std::enable_if<!is_bulk_serializable<T>::value>::type> {
 			/**
 			 * Returns the buffer size required to serialize the specified
 			 * array, i.e. the sum of `p.size(item)` for each item in `array`.
@@ -1331,6 +1665,68 @@ namespace fpmas { namespace io { namespace datapack {
 				}
 		};
 
+	/**
+	 * std::array Serializer specialization for is_bulk_serializable types.
+	 *
+	 * The serialization scheme is the same as the regular std::array
+	 * Serializer, but items are written and read using a single
+	 * `std::memcpy` operation.
+	 *
+	 * | Serialization scheme |
+	 * |----------------------|
+	 * | array.data() (T array) |
+	 *
+	 * @tparam T value type
+	 * @tparam N array size
+	 */
+	template<typename T, std::size_t N>
+		struct Serializer<std::array<T, N>,
+		typename std::enable_if<is_bulk_serializable<T>::value>::type> {
+			static_assert(std::is_trivially_copyable<T>::value,
+					"is_trivially_serializable types must be trivially copyable");
+
+			/**
+			 * Returns the buffer size required to serialize any array, i.e.
+			 * `N*sizeof(T)`.
+			 */
+			template<typename PackType>
+				static std::size_t size(const PackType&) {
+					return N*sizeof(T);
+				}
+
+			/**
+			 * Equivalent to size(const PackType&).
+			 */
+			template<typename PackType>
+				static std::size_t size(const PackType& p, const std::array<T, N>&) {
+					return size(p);
+				}
+
+			/**
+			 * Serializes `array` to `pack`.
+			 *
+			 * @param pack destination BasicObjectPack
+			 * @param array array to serialize
+			 */
+			template<typename PackType>
+				static void to_datapack(PackType& pack, const std::array<T, N>& array) {
+					pack.write(array.data(), N*sizeof(T));
+				}
+
+			/**
+			 * Unserializes an array from `pack`.
+			 *
+			 * @param pack source BasicObjectPack
+			 * @return unserialized array
+			 */
+			template<typename PackType>
+				static std::array<T, N> from_datapack(const PackType& pack) {
+					std::array<T, N> array;
+					pack.read(array.data(), N*sizeof(T));
+					return array;
+				}
+		};
+
 	/**
 	 * api::graph::DistributedId Serializer specialization.
 	 *
@@ -1453,6 +1849,55 @@ namespace fpmas { namespace io { namespace datapack {
 			}
 		};
 
+	/**
+	 * Serialization profile used to transmit data of \DISTANT nodes, i.e.
+	 * "ghost" data, notably by the fpmas::synchro::ghost::GhostDataSync.
+	 *
+	 * Contrary to the LightSerializer, the GhostSerializer writes data in a
+	 * regular ObjectPack, so that ghost data can be embedded in any other
+	 * ObjectPack. However, only the part of T that is read from \DISTANT
+	 * nodes needs to be serialized, while the regular Serializer is still
+	 * used to migrate nodes.
+	 *
+	 * By default, falls back to the Serializer<T> specialization, but custom
+	 * GhostSerializer specializations can be defined.
+	 *
+	 * @see fpmas::io::datapack::GhostSerializer<fpmas::api::model::AgentPtr>
+	 */
+	template<typename T, typename Enable = void>
+		struct GhostSerializer {
+			/**
+			 * Returns the buffer size required to serialize `item` into `p`
+			 * using the regular Serializer<T>::size(const ObjectPack&, const
+			 * T&) method.
+			 */
+			static std::size_t size(const ObjectPack& p, const T& item) {
+				return Serializer<T>::size(p, item);
+			}
+
+			/**
+			 * Serializes `item` into `pack` using the regular
+			 * Serializer<T>::to_datapack() specialization.
+			 *
+			 * @param pack destination pack
+			 * @param item item to serialize
+			 */
+			static void to_datapack(ObjectPack& pack, const T& item) {
+				Serializer<T>::to_datapack(pack, item);
+			}
+
+			/**
+			 * Unserializes data from `pack` using the regular
+			 * Serializer<T>::from_datapack() specialization.
+			 *
+			 * @param pack source pack
+			 * @return deserialized data
+			 */
+			static T from_datapack(const ObjectPack& pack) {
+				return Serializer<T>::from_datapack(pack);
+			}
+		};
+
 	/**
 	 * BasicObjectPack output stream operator specialization.
 	 *
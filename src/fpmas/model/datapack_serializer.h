@@ -53,6 +53,23 @@
 			::from_datapack(const ObjectPack& p) {\
 			return {AgentPtrSerializer<ObjectPack, __VA_ARGS__ , void>::from_datapack(p)};\
 		}\
+		void Serializer<api::model::AgentPtr>\
+			::update_datapack(const ObjectPack& p, api::model::AgentPtr& data) {\
+			AgentPtrSerializer<ObjectPack, __VA_ARGS__ , void>::update_datapack(p, data);\
+		}\
+		\
+		std::size_t GhostSerializer<api::model::AgentPtr>\
+			::size(const ObjectPack& p, const api::model::AgentPtr& data) {\
+			return AgentPtrSerializer<ObjectPack, __VA_ARGS__ , void>::ghost_size(p, data);\
+		}\
+		void GhostSerializer<api::model::AgentPtr>\
+			::to_datapack(ObjectPack& p, const api::model::AgentPtr& data) {\
+			AgentPtrSerializer<ObjectPack, __VA_ARGS__ , void>::ghost_to_datapack(p, data);\
+		}\
+		void GhostSerializer<api::model::AgentPtr>\
+			::update_datapack(const ObjectPack& p, api::model::AgentPtr& data) {\
+			AgentPtrSerializer<ObjectPack, __VA_ARGS__ , void>::ghost_update_datapack(p, data);\
+		}\
 		\
 		std::size_t Serializer<api::model::WeakAgentPtr>\
 			::size(const ObjectPack& p, const api::model::WeakAgentPtr& data) {\
@@ -108,6 +125,19 @@
 		fpmas::api::model::AgentPtr Serializer<fpmas::api::model::AgentPtr>::from_datapack(const ObjectPack& o) {\
 			return {AgentPtrSerializer<ObjectPack, void>::from_datapack(o)};\
 		}\
+		void Serializer<fpmas::api::model::AgentPtr>::update_datapack(const ObjectPack& o, fpmas::api::model::AgentPtr& data) {\
+			AgentPtrSerializer<ObjectPack, void>::update_datapack(o, data);\
+		}\
+		\
+		std::size_t GhostSerializer<fpmas::api::model::AgentPtr>::size(const ObjectPack& o, const fpmas::api::model::AgentPtr& data) {\
+			return AgentPtrSerializer<ObjectPack, void>::ghost_size(o, data);\
+		}\
+		void GhostSerializer<fpmas::api::model::AgentPtr>::to_datapack(ObjectPack& o, const fpmas::api::model::AgentPtr& data) {\
+			AgentPtrSerializer<ObjectPack, void>::ghost_to_datapack(o, data);\
+		}\
+		void GhostSerializer<fpmas::api::model::AgentPtr>::update_datapack(const ObjectPack& o, fpmas::api::model::AgentPtr& data) {\
+			AgentPtrSerializer<ObjectPack, void>::ghost_update_datapack(o, data);\
+		}\
 		\
 		std::size_t Serializer<fpmas::api::model::WeakAgentPtr>::size(const ObjectPack& o, const fpmas::api::model::WeakAgentPtr& data) {\
 			return AgentPtrSerializer<ObjectPack, void>::size(o, data);\
@@ -181,6 +211,13 @@
 				static fpmas::api::utils::PtrWrapper<AGENT> from_datapack(const PackType&) {\
 					return {new AGENT};\
 				}\
+				\
+				/**\
+				 * No effect: there is no data to unserialize.
+				 */\
+				template<typename PackType>\
+				static void update_datapack(const PackType&, fpmas::api::utils::PtrWrapper<AGENT>) {\
+				}\
 			};\
 	}}}
 
@@ -225,6 +262,34 @@ namespace fpmas { namespace io { namespace datapack {
 					return new_id;
 				}
 
+				/**
+				 * Returns the count of ids associated to types by
+				 * register_type().
+				 *
+				 * Since ids are assigned incrementally from 0, all
+				 * registered ids are strictly lower than this value.
+				 */
+				static FPMAS_TYPE_INDEX registered_count() {
+					return id;
+				}
+
+				/**
+				 * Retrieves the unique integer id associated to `type`.
+				 *
+				 * @param type registered type
+				 * @param type_id output id
+				 * @return true iff `type` was registered using
+				 * register_type(), in which case `type_id` is set
+				 */
+				static bool find_id(
+						const std::type_index& type, FPMAS_TYPE_INDEX& type_id) {
+					auto _id = type_to_id.find(type);
+					if(_id == type_to_id.end())
+						return false;
+					type_id = _id->second;
+					return true;
+				}
+
 				/**
 				 * Returns the buffer size required to serialize an
 				 * std::type_index instance, i.e. pack.size<FPMAS_TYPE_INDEX>();
@@ -578,6 +643,377 @@ namespace fpmas { namespace io { namespace datapack {
 				}
 			};
 
+	/**
+	 * Helper used by AgentPtrSerializer to unserialize an `AgentType`
+	 * instance directly into an existing \Agent.
+	 *
+	 * By default, a temporary `AgentType` is unserialized from the pack and
+	 * moved into the existing \Agent using api::model::Agent::moveAssign().
+	 *
+	 * @tparam PackType type of ObjectPack used for serialization
+	 * @tparam AgentType concrete type of \Agent to unserialize
+	 */
+	template<typename PackType, typename AgentType, typename Enable = void>
+		struct AgentUpdate {
+			/**
+			 * Unserializes an `AgentType` instance from `pack` and moves it
+			 * into `agent`.
+			 *
+			 * @param pack source pack
+			 * @param agent existing agent to update
+			 */
+			static void update(const PackType& pack, AgentType* agent) {
+				TypedAgentPtr<AgentType> updated_agent
+					= pack.template get<TypedAgentPtr<AgentType>>();
+				agent->moveAssign(updated_agent.get());
+				delete updated_agent.get();
+			}
+		};
+
+	/**
+	 * AgentUpdate specialization, selected when `AgentType` defines a
+	 * `static void update_datapack(const PackType&, AgentType*)` method. In
+	 * this case, data is unserialized directly into the existing \Agent, so
+	 * that no temporary \Agent is allocated.
+	 *
+	 * @tparam PackType type of ObjectPack used for serialization
+	 * @tparam AgentType concrete type of \Agent to unserialize
+	 */
+	template<typename PackType, typename AgentType>
+		struct AgentUpdate<PackType, AgentType, decltype(AgentType::update_datapack(
+					std::declval<const PackType&>(), std::declval<AgentType*>()
+					))> {
+			/**
+			 * Calls `AgentType::update_datapack(pack, agent)`.
+			 *
+			 * @param pack source pack
+			 * @param agent existing agent to update
+			 */
+			static void update(const PackType& pack, AgentType* agent) {
+				AgentType::update_datapack(pack, agent);
+			}
+		};
+
+	/**
+	 * Defines `value` to true iff `AgentType` defines a
+	 * `static void update_datapack(const PackType&, AgentType*)` method.
+	 */
+	template<typename PackType, typename AgentType, typename Enable = void>
+		struct has_static_update_datapack : public std::false_type {
+		};
+
+	/**
+	 * has_static_update_datapack specialization, selected when the
+	 * `AgentType::update_datapack()` method is defined.
+	 */
+	template<typename PackType, typename AgentType>
+		struct has_static_update_datapack<PackType, AgentType, decltype(
+				AgentType::update_datapack(
+					std::declval<const PackType&>(), std::declval<AgentType*>()
+					))> : public std::true_type {
+		};
+
+	/**
+	 * AgentUpdate specialization, selected when `AgentType` does not define
+	 * any static `update_datapack()` method, but a
+	 * `Serializer<PtrWrapper<AgentType>>` specialization with an
+	 * `update_datapack(const PackType&, PtrWrapper<AgentType>)` method is
+	 * available.
+	 *
+	 * This is notably the case of polymorphic serialization chains, such as
+	 * the SpatialAgentBase -> GridAgent -> `Derived` chain: each base
+	 * updates its own fields, and the `Derived` part is updated recursively
+	 * using AgentUpdate<PackType, Derived>.
+	 *
+	 * @tparam PackType type of ObjectPack used for serialization
+	 * @tparam AgentType concrete type of \Agent to unserialize
+	 */
+	template<typename PackType, typename AgentType>
+		struct AgentUpdate<PackType, AgentType, typename std::enable_if<
+			!has_static_update_datapack<PackType, AgentType>::value,
+			decltype(Serializer<api::utils::PtrWrapper<AgentType>>::update_datapack(
+					std::declval<const PackType&>(),
+					std::declval<api::utils::PtrWrapper<AgentType>>()
+					))>::type> {
+			/**
+			 * Calls `Serializer<PtrWrapper<AgentType>>::update_datapack(pack,
+			 * agent)`.
+			 *
+			 * @param pack source pack
+			 * @param agent existing agent to update
+			 */
+			static void update(const PackType& pack, AgentType* agent) {
+				Serializer<api::utils::PtrWrapper<AgentType>>::update_datapack(
+						pack, api::utils::PtrWrapper<AgentType>(agent));
+			}
+		};
+
+	/**
+	 * GhostSerializer specialization for \Agent types that define their
+	 * own ghost serialization rules, i.e. the following static methods:
+	 * ```cpp
+	 * static std::size_t ghost_size(
+	 * 	const fpmas::io::datapack::ObjectPack& pack,
+	 * 	const AgentType* agent
+	 * 	);
+	 * static void ghost_to_datapack(
+	 * 	fpmas::io::datapack::ObjectPack& pack,
+	 * 	const AgentType* agent
+	 * 	);
+	 * static void ghost_update_datapack(
+	 * 	const fpmas::io::datapack::ObjectPack& pack,
+	 * 	AgentType* agent
+	 * 	);
+	 * ```
+	 * Only fields read from \DISTANT \Agents, such as a position or an
+	 * opinion, should be serialized by `ghost_to_datapack()`.
+	 * `ghost_update_datapack()` reads the same fields and assigns them to the
+	 * existing `agent`: other fields of a ghost \Agent are left unchanged.
+	 *
+	 * \par Example
+	 * ```cpp
+	 * class Agent1 : public fpmas::model::AgentBase<Agent1> {
+	 * 	private:
+	 * 		int opinion;
+	 * 		std::vector<int> history;
+	 * 	public:
+	 * 		...
+	 * 		static std::size_t ghost_size(
+	 * 			const fpmas::io::datapack::ObjectPack& p, const Agent1* agent) {
+	 * 			return p.size(agent->opinion);
+	 * 		}
+	 * 		static void ghost_to_datapack(
+	 * 			fpmas::io::datapack::ObjectPack& p, const Agent1* agent) {
+	 * 			p.put(agent->opinion);
+	 * 		}
+	 * 		static void ghost_update_datapack(
+	 * 			const fpmas::io::datapack::ObjectPack& p, Agent1* agent) {
+	 * 			agent->opinion = p.get<int>();
+	 * 		}
+	 * };
+	 * ```
+	 *
+	 * @tparam AgentType concrete type of \Agent to serialize
+	 */
+	template<typename AgentType>
+		struct GhostSerializer<api::utils::PtrWrapper<AgentType>, decltype(
+				AgentType::ghost_to_datapack(
+					std::declval<ObjectPack&>(), std::declval<const AgentType*>()
+					))> {
+			/**
+			 * Returns `AgentType::ghost_size(p, agent_ptr.get())`.
+			 */
+			static std::size_t size(
+					const ObjectPack& p,
+					const api::utils::PtrWrapper<AgentType>& agent_ptr) {
+				return AgentType::ghost_size(p, agent_ptr.get());
+			}
+
+			/**
+			 * Calls `AgentType::ghost_to_datapack(pack, agent_ptr.get())`.
+			 *
+			 * @param pack destination ObjectPack
+			 * @param agent_ptr agent to serialize
+			 */
+			static void to_datapack(
+					ObjectPack& pack,
+					const api::utils::PtrWrapper<AgentType>& agent_ptr) {
+				AgentType::ghost_to_datapack(pack, agent_ptr.get());
+			}
+
+			/**
+			 * Calls `AgentType::ghost_update_datapack(pack, agent_ptr.get())`.
+			 *
+			 * @param pack source ObjectPack
+			 * @param agent_ptr existing agent to update
+			 */
+			static void update_datapack(
+					const ObjectPack& pack,
+					api::utils::PtrWrapper<AgentType> agent_ptr) {
+				AgentType::ghost_update_datapack(pack, agent_ptr.get());
+			}
+		};
+
+	/**
+	 * Helper used to serialize ghost \Agents, notably by AgentPtrSerializer
+	 * and polymorphic \Agent base GhostSerializer specializations.
+	 *
+	 * By default, no ghost serialization rules are defined for
+	 * `AgentType`: the regular Serializer is used, and ghost \Agents are
+	 * updated using the AgentUpdate helper.
+	 *
+	 * @tparam AgentType type of \Agent to serialize
+	 */
+	template<typename AgentType, typename Enable = void>
+		struct AgentGhostSerializer {
+			/**
+			 * Returns `p.size(agent_ptr)`.
+			 */
+			static std::size_t size(
+					const ObjectPack& p,
+					const api::utils::PtrWrapper<AgentType>& agent_ptr) {
+				return p.size(agent_ptr);
+			}
+
+			/**
+			 * Serializes `agent_ptr` with the regular Serializer.
+			 *
+			 * @param pack destination ObjectPack
+			 * @param agent_ptr agent to serialize
+			 */
+			static void to_datapack(
+					ObjectPack& pack,
+					const api::utils::PtrWrapper<AgentType>& agent_ptr) {
+				pack.put(agent_ptr);
+			}
+
+			/**
+			 * Updates the agent pointed by `agent_ptr` using
+			 * AgentUpdate<ObjectPack, AgentType>::update().
+			 *
+			 * @param pack source ObjectPack
+			 * @param agent_ptr existing agent to update
+			 */
+			static void update_datapack(
+					const ObjectPack& pack,
+					api::utils::PtrWrapper<AgentType> agent_ptr) {
+				AgentUpdate<ObjectPack, AgentType>::update(pack, agent_ptr.get());
+			}
+		};
+
+	/**
+	 * AgentGhostSerializer specialization, selected when a
+	 * `GhostSerializer<PtrWrapper<AgentType>>` specialization with an
+	 * `update_datapack()` method is available. In this case, the
+	 * GhostSerializer specialization is used.
+	 *
+	 * @tparam AgentType type of \Agent to serialize
+	 */
+	template<typename AgentType>
+		struct AgentGhostSerializer<AgentType, decltype(
+				GhostSerializer<api::utils::PtrWrapper<AgentType>>::update_datapack(
+					std::declval<const ObjectPack&>(),
+					std::declval<const api::utils::PtrWrapper<AgentType>&>()
+					))> {
+			/**
+			 * Returns `GhostSerializer<PtrWrapper<AgentType>>::size(p, agent_ptr)`.
+			 */
+			static std::size_t size(
+					const ObjectPack& p,
+					const api::utils::PtrWrapper<AgentType>& agent_ptr) {
+				return GhostSerializer<api::utils::PtrWrapper<AgentType>>
+					::size(p, agent_ptr);
+			}
+
+			/**
+			 * Calls `GhostSerializer<PtrWrapper<AgentType>>::to_datapack(pack,
+			 * agent_ptr)`.
+			 *
+			 * @param pack destination ObjectPack
+			 * @param agent_ptr agent to serialize
+			 */
+			static void to_datapack(
+					ObjectPack& pack,
+					const api::utils::PtrWrapper<AgentType>& agent_ptr) {
+				GhostSerializer<api::utils::PtrWrapper<AgentType>>
+					::to_datapack(pack, agent_ptr);
+			}
+
+			/**
+			 * Calls
+			 * `GhostSerializer<PtrWrapper<AgentType>>::update_datapack(pack,
+			 * agent_ptr)`.
+			 *
+			 * @param pack source ObjectPack
+			 * @param agent_ptr existing agent to update
+			 */
+			static void update_datapack(
+					const ObjectPack& pack,
+					api::utils::PtrWrapper<AgentType> agent_ptr) {
+				GhostSerializer<api::utils::PtrWrapper<AgentType>>
+					::update_datapack(pack, agent_ptr);
+			}
+		};
+
+	/**
+	 * Jump table used by AgentPtrSerializer to dispatch the serialization of
+	 * polymorphic \Agents to their concrete type in constant time.
+	 *
+	 * Entries are indexed by the id associated to each \Agent type by
+	 * Serializer<std::type_index>::register_type().
+	 *
+	 * @tparam PackType type of ObjectPack used for serialization
+	 */
+	template<typename PackType>
+		struct AgentPtrJumpTable {
+			/**
+			 * Serialization functions associated to a concrete \Agent
+			 * type.
+			 */
+			struct Entry {
+				/**
+				 * Computes the buffer size required to serialize an \Agent,
+				 * including its type id.
+				 */
+				std::size_t (*size)(const PackType&, const WeakAgentPtr&) = nullptr;
+				/**
+				 * Serializes the specified type id and \Agent.
+				 */
+				void (*to_datapack)(
+						PackType&, FPMAS_TYPE_INDEX, const WeakAgentPtr&) = nullptr;
+				/**
+				 * Unserializes an \Agent, assuming its type id was already
+				 * read.
+				 */
+				WeakAgentPtr (*from_datapack)(const PackType&) = nullptr;
+				/**
+				 * Unserializes an \Agent into an existing \Agent of the
+				 * same type, assuming the type id was already read.
+				 */
+				void (*update_datapack)(const PackType&, AgentPtr&) = nullptr;
+				/**
+				 * Computes the buffer size required to serialize the ghost
+				 * part of an \Agent, including its type id.
+				 *
+				 * Ghost data is always serialized in an ObjectPack (see
+				 * GhostSerializer).
+				 */
+				std::size_t (*ghost_size)(const ObjectPack&, const WeakAgentPtr&) = nullptr;
+				/**
+				 * Serializes the specified type id and the ghost part of an
+				 * \Agent.
+				 */
+				void (*ghost_to_datapack)(
+						ObjectPack&, FPMAS_TYPE_INDEX, const WeakAgentPtr&) = nullptr;
+				/**
+				 * Unserializes ghost data into an existing \Agent of the
+				 * same type, assuming the type id was already read.
+				 */
+				void (*ghost_update_datapack)(const ObjectPack&, AgentPtr&) = nullptr;
+			};
+
+			/**
+			 * Entries indexed by type id. Entries of types that are not
+			 * handled by the AgentPtrSerializer are left empty.
+			 */
+			std::vector<Entry> entries;
+			/**
+			 * Value of Serializer<std::type_index>::registered_count() when
+			 * the table was built.
+			 */
+			FPMAS_TYPE_INDEX registered_count = 0;
+
+			/**
+			 * Returns the Entry associated to `type_id`, or `nullptr` if
+			 * there is no such entry.
+			 */
+			const Entry* find(FPMAS_TYPE_INDEX type_id) const {
+				if(type_id < entries.size() && entries[type_id].size != nullptr)
+					return &entries[type_id];
+				return nullptr;
+			}
+		};
+
 	template<typename PackType, typename Type, typename... AgentTypes> 
 		struct AgentPtrSerializer;
 
@@ -614,6 +1050,51 @@ namespace fpmas { namespace io { namespace datapack {
 			 * @throw exceptions::BadIdException
 			 */
 			static WeakAgentPtr from_datapack(const PackType& p);
+
+			/**
+			 * update_datapack recursion base case.
+			 *
+			 * Reaching this case is erroneous and throws an
+			 * exceptions::BadIdException instance.
+			 *
+			 * @throw exceptions::BadIdException
+			 */
+			static void update_datapack(const PackType& p, AgentPtr&) {
+				from_datapack(p);
+			}
+
+			/**
+			 * ghost_size recursion base case.
+			 *
+			 * @throw exceptions::BadTypeException
+			 */
+			static std::size_t ghost_size(const PackType& p, const WeakAgentPtr& ptr) {
+				return size(p, ptr);
+			}
+
+			/**
+			 * ghost_to_datapack recursion base case.
+			 *
+			 * @throw exceptions::BadTypeException
+			 */
+			static void ghost_to_datapack(PackType& p, const WeakAgentPtr& ptr) {
+				to_datapack(p, ptr);
+			}
+
+			/**
+			 * ghost_update_datapack recursion base case.
+			 *
+			 * @throw exceptions::BadIdException
+			 */
+			static void ghost_update_datapack(const PackType& p, AgentPtr& ptr) {
+				update_datapack(p, ptr);
+			}
+
+			/**
+			 * Jump table build recursion base case: does nothing.
+			 */
+			static void build(AgentPtrJumpTable<PackType>&) {
+			}
 		};
 
 	template<typename PackType>
@@ -647,8 +1128,13 @@ namespace fpmas { namespace io { namespace datapack {
 		}
 
 	/**
-	 * Generic AgentPtr serializer, that recursively deduces the final and
-	 * concrete types of polymorphic AgentPtr instances.
+	 * Generic AgentPtr serializer, that deduces the final and concrete types
+	 * of polymorphic AgentPtr instances.
+	 *
+	 * The concrete type of each \Agent is retrieved in constant time, using
+	 * an AgentPtrJumpTable indexed by registered type ids. The table is
+	 * recursively built from `Type` and `AgentTypes` the first time it is
+	 * used, and rebuilt if new types are registered afterwards.
 	 *
 	 * @tparam PackType type of ObjectPack used for serialization
 	 * @tparam Type type currently inspected
@@ -657,84 +1143,267 @@ namespace fpmas { namespace io { namespace datapack {
 	 */
 	template<typename PackType, typename Type, typename... AgentTypes> 
 		struct AgentPtrSerializer {
-			/**
-			 * Recursive size method used to compute the buffer size required
-			 * to serialize the polymorphic \Agent pointed by `ptr` into `p`.
-			 */
-			static std::size_t size(const PackType& p, const WeakAgentPtr& ptr) {
-				if(ptr->typeId() == Type::TYPE_ID) {
+			private:
+				static std::size_t typed_size(
+						const PackType& p, const WeakAgentPtr& ptr) {
 					return p.template size<api::model::TypeId>()
 						+ p.template size(TypedAgentPtr<Type>(
 							const_cast<Type*>(static_cast<const Type*>(ptr.get()))
 							))
 						+ p.template size(ptr->groupIds());
 				}
-				return AgentPtrSerializer<PackType, AgentTypes...>::size(p, ptr);
-			}
 
-			/**
-			 * Recursive to_datapack method used to serialize the polymorphic
-			 * \Agent pointed by `ptr` into `p`.
-			 *
-			 * `Type` corresponds to the currently examined \Agent type. If this
-			 * type id (i.e. Type::TYPE_ID) corresponds to the `ptr` \Agent type
-			 * (i.e.  `ptr->typedId()`), the underlying agent is serialized
-			 * using the specified PackType.
-			 *
-			 * Else, attempts to recursively serialize `ptr` with
-			 * `AgentPtrSerializer<AgentTypes...>::%to_datapack(p, ptr)`. Notice
-			 * that the last value of `AgentTypes` **must** be void to reach
-			 * the recursion base case (see to_datapack<void>).
-			 *
-			 * @param p destination ObjectPack
-			 * @param ptr polymorphic agent pointer to serialize
-			 */
-			static void to_datapack(
-					PackType& p, const WeakAgentPtr& ptr) {
-				if(ptr->typeId() == Type::TYPE_ID) {
-					p.put(Type::TYPE_ID);
+				static void typed_to_datapack(
+						PackType& p, FPMAS_TYPE_INDEX type_id,
+						const WeakAgentPtr& ptr) {
+					// Equivalent to p.put(Type::TYPE_ID), without
+					// additional type id lookup
+					p.put(type_id);
 					p.put(TypedAgentPtr<Type>(
 							const_cast<Type*>(static_cast<const Type*>(ptr.get()))
 							));
 					p.put(ptr->groupIds());
-				} else {
-					AgentPtrSerializer<PackType, AgentTypes...>::to_datapack(p, ptr);
 				}
-			}
 
-			/**
-			 * Recursive from_datapack method used to unserialize polymorphic \Agent
-			 * pointers from ObjectPacks.
-			 *
-			 * `Type` corresponds to the currently examined \Agent type. If
-			 * this type id (i.e. Type::TYPE_ID) corresponds to the
-			 * ObjectPack type id value , the ObjectPack is unserialized
-			 * using the specified PackType.
-			 *
-			 * Else, attempts to recursively unserialize the ObjectPack with
-			 * `AgentPtrSerializer<AgentTypes...>::%from_datapack(p, ptr)`.
-			 * Notice that the last value of `AgentTypes` **must** be void to
-			 * reach the recursion base case (see from_datapack<void>).
-			 *
-			 * @param p source ObjectPack
-			 * @return ptr unserialized polymorphic agent pointer
-			 */
-			static WeakAgentPtr from_datapack(const PackType& p) {
-				std::size_t pos = p.readOffset();
-				fpmas::api::model::TypeId id = p
-					.template get<fpmas::api::model::TypeId>();
-				if(id == Type::TYPE_ID) {
+				static WeakAgentPtr typed_from_datapack(const PackType& p) {
 					auto agent = p
 						.template get<TypedAgentPtr<Type>>();
 					for(auto gid : 
 							p.template get<std::vector<api::model::GroupId>>())
 						agent->addGroupId(gid);
 					return {agent};
-				} else {
+				}
+
+				static void typed_update_datapack(
+						const PackType& p, AgentPtr& local_agent) {
+					AgentUpdate<PackType, Type>::update(
+							p, static_cast<Type*>(local_agent.get()));
+					synchro::DataUpdate<AgentPtr>::updateGroups(
+							local_agent.get(),
+							p.template get<std::vector<api::model::GroupId>>()
+							);
+				}
+
+				static std::size_t typed_ghost_size(
+						const ObjectPack& p, const WeakAgentPtr& ptr) {
+					return p.size<api::model::TypeId>()
+						+ AgentGhostSerializer<Type>::size(p, TypedAgentPtr<Type>(
+							const_cast<Type*>(static_cast<const Type*>(ptr.get()))
+							))
+						+ p.size(ptr->groupIds());
+				}
+
+				static void typed_ghost_to_datapack(
+						ObjectPack& p, FPMAS_TYPE_INDEX type_id,
+						const WeakAgentPtr& ptr) {
+					p.put(type_id);
+					AgentGhostSerializer<Type>::to_datapack(p, TypedAgentPtr<Type>(
+							const_cast<Type*>(static_cast<const Type*>(ptr.get()))
+							));
+					p.put(ptr->groupIds());
+				}
+
+				static void typed_ghost_update_datapack(
+						const ObjectPack& p, AgentPtr& local_agent) {
+					AgentGhostSerializer<Type>::update_datapack(
+							p, TypedAgentPtr<Type>(static_cast<Type*>(local_agent.get())));
+					synchro::DataUpdate<AgentPtr>::updateGroups(
+							local_agent.get(),
+							p.get<std::vector<api::model::GroupId>>()
+							);
+				}
+
+				static const AgentPtrJumpTable<PackType>& jump_table() {
+					static AgentPtrJumpTable<PackType> table;
+					FPMAS_TYPE_INDEX count
+						= Serializer<std::type_index>::registered_count();
+					if(table.registered_count != count) {
+						table.entries.assign(count, {});
+						table.registered_count = count;
+						build(table);
+					}
+					return table;
+				}
+
+			public:
+				/**
+				 * Recursively registers serialization functions of `Type`
+				 * and `AgentTypes` into `table`.
+				 *
+				 * Types that are not registered in
+				 * Serializer<std::type_index> are ignored.
+				 *
+				 * @param table jump table to build
+				 */
+				static void build(AgentPtrJumpTable<PackType>& table) {
+					FPMAS_TYPE_INDEX type_id;
+					if(Serializer<std::type_index>::find_id(Type::TYPE_ID, type_id)
+							&& table.entries[type_id].size == nullptr)
+						table.entries[type_id] = {
+							&typed_size, &typed_to_datapack, &typed_from_datapack,
+							&typed_update_datapack, &typed_ghost_size,
+							&typed_ghost_to_datapack, &typed_ghost_update_datapack
+						};
+					AgentPtrSerializer<PackType, AgentTypes...>::build(table);
+				}
+
+				/**
+				 * Computes the buffer size required to serialize the
+				 * polymorphic \Agent pointed by `ptr` into `p`.
+				 *
+				 * @throw exceptions::BadTypeException if the type of `ptr`
+				 * is not registered
+				 */
+				static std::size_t size(const PackType& p, const WeakAgentPtr& ptr) {
+					FPMAS_TYPE_INDEX type_id;
+					if(Serializer<std::type_index>::find_id(ptr->typeId(), type_id))
+						if(auto entry = jump_table().find(type_id))
+							return entry->size(p, ptr);
+					return AgentPtrSerializer<PackType, void>::size(p, ptr);
+				}
+
+				/**
+				 * Serializes the polymorphic \Agent pointed by `ptr` into
+				 * `p`.
+				 *
+				 * The registered type id of `ptr->typeId()` is serialized
+				 * first, followed by the concrete \Agent and its group ids.
+				 *
+				 * @param p destination ObjectPack
+				 * @param ptr polymorphic agent pointer to serialize
+				 * @throw exceptions::BadTypeException if the type of `ptr`
+				 * is not registered
+				 */
+				static void to_datapack(
+						PackType& p, const WeakAgentPtr& ptr) {
+					FPMAS_TYPE_INDEX type_id;
+					if(Serializer<std::type_index>::find_id(ptr->typeId(), type_id))
+						if(auto entry = jump_table().find(type_id))
+							return entry->to_datapack(p, type_id, ptr);
+					AgentPtrSerializer<PackType, void>::to_datapack(p, ptr);
+				}
+
+				/**
+				 * Unserializes a polymorphic \Agent pointer from `p`.
+				 *
+				 * The serialized type id is read first, and used to
+				 * unserialize the concrete \Agent.
+				 *
+				 * @param p source ObjectPack
+				 * @return ptr unserialized polymorphic agent pointer
+				 * @throw exceptions::BadIdException if the type id does not
+				 * correspond to a registered type
+				 */
+				static WeakAgentPtr from_datapack(const PackType& p) {
+					std::size_t pos = p.readOffset();
+					FPMAS_TYPE_INDEX type_id = p.template get<FPMAS_TYPE_INDEX>();
+					if(auto entry = jump_table().find(type_id))
+						return entry->from_datapack(p);
 					p.seekRead(pos);
-					return AgentPtrSerializer<PackType, AgentTypes...>::from_datapack(p);
+					return AgentPtrSerializer<PackType, void>::from_datapack(p);
+				}
+
+				/**
+				 * Unserializes a polymorphic \Agent from `p` into
+				 * `local_agent`.
+				 *
+				 * If the serialized \Agent has the same type as
+				 * `local_agent`, data is directly unserialized into
+				 * `local_agent` using the AgentUpdate helper. Else, a
+				 * temporary \Agent is unserialized and pulled into
+				 * `local_agent` using
+				 * synchro::DataUpdate<AgentPtr>::update().
+				 *
+				 * In any case, groups of `local_agent` are updated as
+				 * specified by synchro::DataUpdate<AgentPtr>.
+				 *
+				 * @param p source ObjectPack
+				 * @param local_agent local agent to update
+				 * @throw exceptions::BadIdException if the type id does not
+				 * correspond to a registered type
+				 */
+				static void update_datapack(const PackType& p, AgentPtr& local_agent) {
+					std::size_t pos = p.readOffset();
+					FPMAS_TYPE_INDEX type_id = p.template get<FPMAS_TYPE_INDEX>();
+					FPMAS_TYPE_INDEX local_type_id;
+					if(Serializer<std::type_index>::find_id(
+								local_agent->typeId(), local_type_id)
+							&& local_type_id == type_id)
+						if(auto entry = jump_table().find(type_id))
+							return entry->update_datapack(p, local_agent);
+					p.seekRead(pos);
+					synchro::DataUpdate<AgentPtr>::update(
+							local_agent, AgentPtr(from_datapack(p).get())
+							);
+				}
+
+				/**
+				 * Computes the buffer size required to serialize the ghost
+				 * part of the polymorphic \Agent pointed by `ptr` into `p`.
+				 *
+				 * @throw exceptions::BadTypeException if the type of `ptr`
+				 * is not registered
+				 */
+				static std::size_t ghost_size(
+						const ObjectPack& p, const WeakAgentPtr& ptr) {
+					FPMAS_TYPE_INDEX type_id;
+					if(Serializer<std::type_index>::find_id(ptr->typeId(), type_id))
+						if(auto entry = jump_table().find(type_id))
+							return entry->ghost_size(p, ptr);
+					return AgentPtrSerializer<PackType, void>::size(p, ptr);
+				}
+
+				/**
+				 * Serializes the ghost part of the polymorphic \Agent
+				 * pointed by `ptr` into `p`.
+				 *
+				 * The registered type id of `ptr->typeId()` is serialized
+				 * first, followed by the ghost part of the concrete \Agent,
+				 * as specified by the AgentGhostSerializer, and its group
+				 * ids.
+				 *
+				 * @param p destination ObjectPack
+				 * @param ptr polymorphic agent pointer to serialize
+				 * @throw exceptions::BadTypeException if the type of `ptr`
+				 * is not registered
+				 */
+				static void ghost_to_datapack(
+						ObjectPack& p, const WeakAgentPtr& ptr) {
+					FPMAS_TYPE_INDEX type_id;
+					if(Serializer<std::type_index>::find_id(ptr->typeId(), type_id))
+						if(auto entry = jump_table().find(type_id))
+							return entry->ghost_to_datapack(p, type_id, ptr);
+					AgentPtrSerializer<PackType, void>::to_datapack(p, ptr);
+				}
+
+				/**
+				 * Unserializes ghost data from `p` into `local_agent`, and
+				 * updates its groups as specified by
+				 * synchro::DataUpdate<AgentPtr>.
+				 *
+				 * Ghost data can only be unserialized into an \Agent of the
+				 * same type, what is always the case for a ghost copy of a
+				 * given \Agent. Otherwise, `p` is assumed to contain a
+				 * complete \Agent, that is handled by update_datapack().
+				 *
+				 * @param p source ObjectPack
+				 * @param local_agent local agent to update
+				 * @throw exceptions::BadIdException if the type id does not
+				 * correspond to a registered type
+				 */
+				static void ghost_update_datapack(
+						const ObjectPack& p, AgentPtr& local_agent) {
+					std::size_t pos = p.readOffset();
+					FPMAS_TYPE_INDEX type_id = p.get<FPMAS_TYPE_INDEX>();
+					FPMAS_TYPE_INDEX local_type_id;
+					if(Serializer<std::type_index>::find_id(
+								local_agent->typeId(), local_type_id)
+							&& local_type_id == type_id)
+						if(auto entry = jump_table().find(type_id))
+							return entry->ghost_update_datapack(p, local_agent);
+					p.seekRead(pos);
+					update_datapack(p, local_agent);
 				}
-			}
 		};
 
 }}}
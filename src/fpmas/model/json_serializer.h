@@ -191,6 +191,34 @@ namespace nlohmann {
 				return new_id;
 			}
 
+			/**
+			 * Returns the count of ids associated to types by
+			 * register_type().
+			 *
+			 * Since ids are assigned incrementally from 0, all registered
+			 * ids are strictly lower than this value.
+			 */
+			static FPMAS_TYPE_INDEX registered_count() {
+				return id;
+			}
+
+			/**
+			 * Retrieves the unique integer id associated to `type`.
+			 *
+			 * @param type registered type
+			 * @param type_id output id
+			 * @return true iff `type` was registered using register_type(),
+			 * in which case `type_id` is set
+			 */
+			static bool find_id(
+					const std::type_index& type, FPMAS_TYPE_INDEX& type_id) {
+				auto _id = type_to_id.find(type);
+				if(_id == type_to_id.end())
+					return false;
+				type_id = _id->second;
+				return true;
+			}
+
 			/**
 			 * Unserializes an std::type_index instance from the specified JSON.
 			 *
@@ -490,6 +518,56 @@ namespace fpmas { namespace io { namespace json {
 	using api::model::AgentPtr;
 	using api::model::WeakAgentPtr;
 
+	/**
+	 * Jump table used by AgentPtrSerializer to dispatch the serialization of
+	 * polymorphic \Agents to their concrete type in constant time.
+	 *
+	 * Entries are indexed by the id associated to each \Agent type by
+	 * nlohmann::adl_serializer<std::type_index>::register_type().
+	 *
+	 * @tparam JsonType type of json used for serialization
+	 */
+	template<typename JsonType>
+		struct AgentPtrJumpTable {
+			/**
+			 * Serialization functions associated to a concrete \Agent
+			 * type.
+			 */
+			struct Entry {
+				/**
+				 * Serializes the specified type id and \Agent.
+				 */
+				void (*to_json)(
+						JsonType&, FPMAS_TYPE_INDEX, const WeakAgentPtr&) = nullptr;
+				/**
+				 * Unserializes an \Agent from its JSON representation.
+				 */
+				WeakAgentPtr (*from_json)(const JsonType&) = nullptr;
+			};
+
+			/**
+			 * Entries indexed by type id. Entries of types that are not
+			 * handled by the AgentPtrSerializer are left empty.
+			 */
+			std::vector<Entry> entries;
+			/**
+			 * Value of
+			 * nlohmann::adl_serializer<std::type_index>::registered_count()
+			 * when the table was built.
+			 */
+			FPMAS_TYPE_INDEX registered_count = 0;
+
+			/**
+			 * Returns the Entry associated to `type_id`, or `nullptr` if
+			 * there is no such entry.
+			 */
+			const Entry* find(FPMAS_TYPE_INDEX type_id) const {
+				if(type_id < entries.size() && entries[type_id].to_json != nullptr)
+					return &entries[type_id];
+				return nullptr;
+			}
+		};
+
 	template<typename JsonType, typename Type, typename... AgentTypes> 
 		struct AgentPtrSerializer;
 
@@ -515,6 +593,12 @@ namespace fpmas { namespace io { namespace json {
 			 * @throw exceptions::BadIdException
 			 */
 			static WeakAgentPtr from_json(const JsonType& j);
+
+			/**
+			 * Jump table build recursion base case: does nothing.
+			 */
+			static void build(AgentPtrJumpTable<JsonType>&) {
+			}
 		};
 
 	template<typename JsonType>
@@ -538,8 +622,13 @@ namespace fpmas { namespace io { namespace json {
 		}
 
 	/**
-	 * Generic AgentPtr serializer, that recursively deduces the final and
-	 * concrete types of polymorphic AgentPtr instances.
+	 * Generic AgentPtr serializer, that deduces the final and concrete types
+	 * of polymorphic AgentPtr instances.
+	 *
+	 * The concrete type of each \Agent is retrieved in constant time, using
+	 * an AgentPtrJumpTable indexed by registered type ids. The table is
+	 * recursively built from `Type` and `AgentTypes` the first time it is
+	 * used, and rebuilt if new types are registered afterwards.
 	 *
 	 * @tparam JsonType type of json used for serialization
 	 * @tparam Type type currently inspected
@@ -548,73 +637,105 @@ namespace fpmas { namespace io { namespace json {
 	 */
 	template<typename JsonType, typename Type, typename... AgentTypes> 
 		struct AgentPtrSerializer {
-			/**
-			 * Recursive to_json method used to serialize polymorphic \Agent
-			 * pointers as JSON.
-			 *
-			 * `Type` corresponds to the currently examined \Agent type. If this
-			 * type id (i.e. Type::TYPE_ID) corresponds to the `ptr` \Agent type
-			 * (i.e.  `ptr->typedId()`), the underlying agent is serialized
-			 * using the specified JsonType.
-			 *
-			 * Else, attempts to recursively serialize `ptr` with
-			 * `to_json<AgentTypes...>(j, ptr)`. Notice that the last value of
-			 * `AgentTypes` **must** be void to reach the recursion base case (see
-			 * to_json<void>).
-			 *
-			 * @param j json
-			 * @param ptr polymorphic agent pointer to serialize
-			 *
-			 * @see nlohmann::adl_serializer<std::type_index>::to_json (used to
-			 * serialize the agent type id)
-			 */
-			static void to_json(
-					JsonType& j, const WeakAgentPtr& ptr) {
-				if(ptr->typeId() == Type::TYPE_ID) {
-					j["type"] = Type::TYPE_ID;
+			private:
+				static void typed_to_json(
+						JsonType& j, FPMAS_TYPE_INDEX type_id,
+						const WeakAgentPtr& ptr) {
+					// Equivalent to j["type"] = Type::TYPE_ID, without
+					// additional type id lookup
+					j["type"] = type_id;
 					j["gids"] = ptr->groupIds();
 					j["agent"] = TypedAgentPtr<Type>(
 							const_cast<Type*>(static_cast<const Type*>(ptr.get()))
 							);
-				} else {
-					AgentPtrSerializer<JsonType, AgentTypes...>::to_json(j, ptr);
 				}
-			}
 
-			/**
-			 * Recursive from_json method used to unserialize polymorphic \Agent
-			 * pointers from JSON.
-			 *
-			 * `Type` corresponds to the currently examined \Agent type. If this
-			 * type id (i.e. Type::TYPE_ID) corresponds to the JSON type id value
-			 * (i.e. j.at("type").get<fpmas::api::model::TypeId>()), the JSON value
-			 * is unserialized using the specified JsonType.
-			 *
-			 * Else, attempts to recursively unserialize the JSON value with
-			 * `from_json<AgentTypes...>(j, ptr)`. Notice that the last value of
-			 * `AgentTypes` **must** be void to reach the recursion base case (see
-			 * from_json<void>).
-			 *
-			 * @param j json
-			 * @return ptr unserialized polymorphic agent pointer
-			 *
-			 * @see nlohmann::adl_serializer<std::type_index>::from_json (used to
-			 * unserialize the agent type id)
-			 */
-			static WeakAgentPtr from_json(const JsonType& j) {
-				fpmas::api::model::TypeId id = j.at("type")
-					.template get<fpmas::api::model::TypeId>();
-				if(id == Type::TYPE_ID) {
+				static WeakAgentPtr typed_from_json(const JsonType& j) {
 					auto agent = j.at("agent").template get<TypedAgentPtr<Type>>();
 					for(auto gid : j.at("gids")
 							.template get<std::vector<fpmas::api::model::GroupId>>())
 						agent->addGroupId(gid);
 					return {agent};
-				} else {
-					return AgentPtrSerializer<JsonType, AgentTypes...>::from_json(j);
 				}
-			}
 
+				static const AgentPtrJumpTable<JsonType>& jump_table() {
+					static AgentPtrJumpTable<JsonType> table;
+					FPMAS_TYPE_INDEX count
+						= nlohmann::adl_serializer<std::type_index>::registered_count();
+					if(table.registered_count != count) {
+						table.entries.assign(count, {});
+						table.registered_count = count;
+						build(table);
+					}
+					return table;
+				}
+
+			public:
+				/**
+				 * Recursively registers serialization functions of `Type`
+				 * and `AgentTypes` into `table`.
+				 *
+				 * Types that are not registered in
+				 * nlohmann::adl_serializer<std::type_index> are ignored.
+				 *
+				 * @param table jump table to build
+				 */
+				static void build(AgentPtrJumpTable<JsonType>& table) {
+					FPMAS_TYPE_INDEX type_id;
+					if(nlohmann::adl_serializer<std::type_index>
+							::find_id(Type::TYPE_ID, type_id)
+							&& table.entries[type_id].to_json == nullptr)
+						table.entries[type_id] = {&typed_to_json, &typed_from_json};
+					AgentPtrSerializer<JsonType, AgentTypes...>::build(table);
+				}
+
+				/**
+				 * Serializes the polymorphic \Agent pointed by `ptr` as
+				 * JSON.
+				 *
+				 * The registered type id of `ptr->typeId()` is serialized in
+				 * the `type` field, the group ids in the `gids` field and
+				 * the concrete \Agent in the `agent` field.
+				 *
+				 * @param j json
+				 * @param ptr polymorphic agent pointer to serialize
+				 * @throw exceptions::BadTypeException if the type of `ptr`
+				 * is not registered
+				 *
+				 * @see nlohmann::adl_serializer<std::type_index>::to_json
+				 * (equivalent type id serialization)
+				 */
+				static void to_json(
+						JsonType& j, const WeakAgentPtr& ptr) {
+					FPMAS_TYPE_INDEX type_id;
+					if(nlohmann::adl_serializer<std::type_index>
+							::find_id(ptr->typeId(), type_id))
+						if(auto entry = jump_table().find(type_id))
+							return entry->to_json(j, type_id, ptr);
+					AgentPtrSerializer<JsonType, void>::to_json(j, ptr);
+				}
+
+				/**
+				 * Unserializes a polymorphic \Agent pointer from JSON.
+				 *
+				 * The type id stored in the `type` field is used to
+				 * unserialize the concrete \Agent.
+				 *
+				 * @param j json
+				 * @return ptr unserialized polymorphic agent pointer
+				 * @throw exceptions::BadIdException if the type id does not
+				 * correspond to a registered type
+				 *
+				 * @see nlohmann::adl_serializer<std::type_index>::from_json
+				 * (equivalent type id unserialization)
+				 */
+				static WeakAgentPtr from_json(const JsonType& j) {
+					FPMAS_TYPE_INDEX type_id = j.at("type")
+						.template get<FPMAS_TYPE_INDEX>();
+					if(auto entry = jump_table().find(type_id))
+						return entry->from_json(j);
+					return AgentPtrSerializer<JsonType, void>::from_json(j);
+				}
 		};
 }}}
 #endif
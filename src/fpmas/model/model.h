@@ -1596,6 +1596,31 @@ namespace fpmas { namespace io { namespace datapack {
 			 * wrapped in an fpmas::api::model::AgentPtr instance
 			 */
 			static AgentPtr from_datapack(const ObjectPack& pack);
+
+			/**
+			 * Unserializes an \Agent from the specified ObjectPack
+			 * directly into the existing `local_agent`.
+			 *
+			 * The result is equivalent to
+			 * `fpmas::synchro::DataUpdate<AgentPtr>::update(local_agent,
+			 * from_datapack(pack))`, but when the serialized \Agent has the
+			 * same type as `local_agent`, no temporary \Agent is allocated
+			 * if the concrete `AgentType` defines the following static
+			 * method:
+			 * ```cpp
+			 * static void update_datapack(
+			 * 	const fpmas::io::datapack::ObjectPack& pack,
+			 * 	AgentType* agent
+			 * 	);
+			 * ```
+			 * `update_datapack()` must read the same fields as
+			 * `AgentType::from_datapack()`, and assign them to the
+			 * specified `agent`.
+			 *
+			 * @param pack source ObjectPack
+			 * @param local_agent local \Agent to update
+			 */
+			static void update_datapack(const ObjectPack& pack, AgentPtr& local_agent);
 		};
 
 	/**
@@ -1747,6 +1772,61 @@ namespace fpmas { namespace io { namespace datapack {
 			 */
 			static WeakAgentPtr from_datapack(const LightObjectPack& pack);
 		};
+
+	/**
+	 * fpmas::api::model::AgentPtr fpmas::io::datapack::GhostSerializer
+	 * serialization rules **declaration**.
+	 *
+	 * Methods are _defined_ by the FPMAS_DATAPACK_SET_UP() macro.
+	 *
+	 * By default, \Agents are serialized with the regular Serializer
+	 * rules. Only fields read from \DISTANT \Agents can be serialized
+	 * instead, defining the following static methods in the concrete
+	 * `AgentType`:
+	 * ```cpp
+	 * static std::size_t ghost_size(
+	 * 	const fpmas::io::datapack::ObjectPack& pack,
+	 * 	const AgentType* agent
+	 * 	);
+	 * static void ghost_to_datapack(
+	 * 	fpmas::io::datapack::ObjectPack& pack,
+	 * 	const AgentType* agent
+	 * 	);
+	 * static void ghost_update_datapack(
+	 * 	const fpmas::io::datapack::ObjectPack& pack,
+	 * 	AgentType* agent
+	 * 	);
+	 * ```
+	 * Since a ghost \Agent cannot be built from partial data, ghost data is
+	 * always unserialized into an existing \Agent.
+	 */
+	template<>
+		struct GhostSerializer<AgentPtr> {
+			/**
+			 * Returns the buffer size required to serialize the ghost part
+			 * of the polymorphic \Agent pointed by `ptr` into `p`.
+			 */
+			static std::size_t size(const ObjectPack& p, const AgentPtr& ptr);
+
+			/**
+			 * Serializes the ghost part of the polymorphic \Agent pointed by
+			 * `pointer` to the specified ObjectPack.
+			 *
+			 * @param pack destination ObjectPack
+			 * @param pointer pointer to polymorphic \Agent
+			 */
+			static void to_datapack(ObjectPack& pack, const AgentPtr& pointer);
+
+			/**
+			 * Unserializes ghost data from `pack` into the existing
+			 * `local_agent`, and updates its groups as specified by
+			 * fpmas::synchro::DataUpdate<AgentPtr>.
+			 *
+			 * @param pack source ObjectPack
+			 * @param local_agent local \Agent to update
+			 */
+			static void update_datapack(const ObjectPack& pack, AgentPtr& local_agent);
+		};
 }}}
 
 namespace fpmas { namespace synchro {
@@ -1794,35 +1874,74 @@ namespace fpmas { namespace synchro {
 				// current behavior, that does much more that just "moving" the
 				// agent.
 
-				// Sets and overrides the fields that must be preserved
-				std::set<api::model::GroupId> local_ids;
-				for(auto id : local_agent->groupIds())
-					local_ids.insert(id);
-				std::set<api::model::GroupId> updated_ids;
-				for(auto id : updated_agent->groupIds())
-					updated_ids.insert(id);
+				// groupIds() are preserved by the move assignment
+				std::vector<api::model::GroupId> updated_ids
+					= updated_agent->groupIds();
+				local_agent = std::move(updated_agent);
+				updateGroups(local_agent.get(), updated_ids);
+			}
+
+			/**
+			 * Updates the local agent with agent data serialized in `pack`
+			 * with the io::datapack::GhostSerializer profile.
+			 *
+			 * Data is unserialized directly into `local_agent`, as specified
+			 * by fpmas::io::datapack::GhostSerializer<AgentPtr>::update_datapack().
+			 * Groups are updated according to the same rules as
+			 * update(api::model::AgentPtr&, api::model::AgentPtr&&).
+			 *
+			 * @param local_agent reference to the local agent to update
+			 * @param pack source ObjectPack
+			 */
+			static void update(
+					api::model::AgentPtr& local_agent,
+					const io::datapack::ObjectPack& pack) {
+				io::datapack::GhostSerializer<api::model::AgentPtr>
+					::update_datapack(pack, local_agent);
+			}
+
+			/**
+			 * Updates the groups of `local_agent` so that they match
+			 * `updated_ids`, as specified in
+			 * update(api::model::AgentPtr&, api::model::AgentPtr&&).
+			 *
+			 * When `updated_ids` is equal to `local_agent->groupIds()`, what
+			 * is the most common case, nothing is done.
+			 *
+			 * @param local_agent local agent to update
+			 * @param updated_ids updated group ids
+			 */
+			static void updateGroups(
+					api::model::Agent* local_agent,
+					const std::vector<api::model::GroupId>& updated_ids) {
+				std::vector<api::model::GroupId> local_ids
+					= local_agent->groupIds();
+				if(local_ids == updated_ids)
+					return;
+
+				std::set<api::model::GroupId> local_set(
+						local_ids.begin(), local_ids.end());
+				std::set<api::model::GroupId> updated_set(
+						updated_ids.begin(), updated_ids.end());
 
 				std::vector<api::model::GroupId> new_groups;
-				for(auto id : updated_ids)
-					if(local_ids.count(id) == 0)
+				for(auto id : updated_set)
+					if(local_set.count(id) == 0)
 						new_groups.push_back(id);
 
 				std::vector<api::model::GroupId> obsolete_groups;
-				for(auto id : local_ids)
-					if(updated_ids.count(id) == 0)
+				for(auto id : local_set)
+					if(updated_set.count(id) == 0)
 						obsolete_groups.push_back(id);
 
-				local_agent = std::move(updated_agent);
-
 				// Dynamically updates groups lists
 				// If `agent` was added to / removed from group on a distant
 				// process for example (assuming that this agent is DISTANT),
 				// this agent representation groups are updated.
 				for(auto id : new_groups)
-					local_agent->model()->getGroup(id).add(local_agent.get());
+					local_agent->model()->getGroup(id).add(local_agent);
 				for(auto id : obsolete_groups)
-					local_agent->model()->getGroup(id).remove(local_agent.get());
-
+					local_agent->model()->getGroup(id).remove(local_agent);
 			}
 		};
 }}
@@ -11,8 +11,8 @@
 
 /**
  * Defines a json based implementation of AgentPtr
- * fpmas::io::datapack::Serializer and fpmas::io::datapack::LightSerializer
- * implementation, that can be used instead of definitions provided by
+ * fpmas::io::datapack::Serializer, fpmas::io::datapack::LightSerializer and
+ * fpmas::io::datapack::GhostSerializer implementation, that can be used instead of definitions provided by
  * FPMAS_BASE_DATAPACK_SET_UP().
  *
  * This allows to use the object pack serialization for DistributedNodes for
@@ -30,6 +30,18 @@
 		AgentPtr Serializer<AgentPtr>::from_datapack(const ObjectPack& p) {\
 			return JsonSerializer<AgentPtr>::from_datapack(p);\
 		}\
+		void Serializer<AgentPtr>::update_datapack(const ObjectPack& p, AgentPtr& ptr) {\
+			synchro::DataUpdate<AgentPtr>::update(ptr, from_datapack(p));\
+		}\
+		std::size_t GhostSerializer<AgentPtr>::size(const ObjectPack& p, const AgentPtr& ptr) {\
+			return Serializer<AgentPtr>::size(p, ptr);\
+		}\
+		void GhostSerializer<AgentPtr>::to_datapack(ObjectPack& p, const AgentPtr& ptr) {\
+			Serializer<AgentPtr>::to_datapack(p, ptr);\
+		}\
+		void GhostSerializer<AgentPtr>::update_datapack(const ObjectPack& p, AgentPtr& ptr) {\
+			Serializer<AgentPtr>::update_datapack(p, ptr);\
+		}\
 		std::size_t LightSerializer<AgentPtr>::size(const LightObjectPack& p, const AgentPtr& ptr) {\
 			return LightJsonSerializer<AgentPtr>::size(p, ptr);\
 		}\
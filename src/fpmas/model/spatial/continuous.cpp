@@ -0,0 +1,67 @@
+#include "continuous.h"
+#include <cmath>
+
+namespace fpmas { namespace model {
+	DiscreteCoordinate ContinuousSpace::binWidth() const {
+		return (DiscreteCoordinate) std::ceil(_width / bin_size);
+	}
+
+	DiscreteCoordinate ContinuousSpace::binHeight() const {
+		return (DiscreteCoordinate) std::ceil(_height / bin_size);
+	}
+
+	bool ContinuousSpace::contains(const ContinuousPoint& point) const {
+		return point.x >= 0 && point.x < _width
+			&& point.y >= 0 && point.y < _height;
+	}
+
+	DiscretePoint ContinuousSpace::bin(const ContinuousPoint& point) const {
+		return {
+			(DiscreteCoordinate) std::floor(point.x / bin_size),
+			(DiscreteCoordinate) std::floor(point.y / bin_size)
+		};
+	}
+
+	ContinuousPoint ContinuousSpace::binCenter(const DiscretePoint& bin) const {
+		return {(bin.x + .5) * bin_size, (bin.y + .5) * bin_size};
+	}
+
+	ContinuousCoordinate ContinuousSpace::binDistance(
+			const DiscretePoint& bin1, const DiscretePoint& bin2) const {
+		// Count of bins strictly between bin1 and bin2 in each direction
+		ContinuousCoordinate dx = std::max<DiscreteCoordinate>(
+				0, std::abs(bin2.x - bin1.x) - 1) * bin_size;
+		ContinuousCoordinate dy = std::max<DiscreteCoordinate>(
+				0, std::abs(bin2.y - bin1.y) - 1) * bin_size;
+		return std::sqrt(dx*dx + dy*dy);
+	}
+
+	DiscreteCoordinate ContinuousSpace::binRadius(ContinuousCoordinate radius) const {
+		if(radius < 0)
+			return 0;
+		return (DiscreteCoordinate) std::floor(radius / bin_size) + 1;
+	}
+}}
+
+namespace fpmas { namespace io { namespace datapack {
+	std::size_t Serializer<api::model::ContinuousPoint>::size(const ObjectPack& p) {
+		return 2*p.size<api::model::ContinuousCoordinate>();
+	}
+	std::size_t Serializer<api::model::ContinuousPoint>::size(
+			const ObjectPack& p, const api::model::ContinuousPoint&) {
+		return size(p);
+	}
+
+	void Serializer<api::model::ContinuousPoint>::to_datapack(
+			ObjectPack& pack, const api::model::ContinuousPoint& point) {
+		pack.put(point.x);
+		pack.put(point.y);
+	}
+
+	api::model::ContinuousPoint Serializer<api::model::ContinuousPoint>::from_datapack(
+			const ObjectPack& pack) {
+		api::model::ContinuousCoordinate x = pack.get<api::model::ContinuousCoordinate>();
+		api::model::ContinuousCoordinate y = pack.get<api::model::ContinuousCoordinate>();
+		return {x, y};
+	}
+}}}
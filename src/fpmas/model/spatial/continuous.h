@@ -0,0 +1,786 @@
+#ifndef FPMAS_CONTINUOUS_H
+#define FPMAS_CONTINUOUS_H
+
+/** \file src/fpmas/model/spatial/continuous.h
+ * Continuous space models implementation.
+ */
+
+#include "fpmas/api/model/spatial/continuous.h"
+#include "moore_grid.h"
+
+/**
+ * Utility macro to define the
+ * fpmas::model::ContinuousAgent::continuousSpace() method for the current
+ * agent so that it returns the specified SPACE.
+ *
+ * This macro must be called within the class definition of a
+ * ContinuousAgent.
+ *
+ * @param SPACE reference to the fpmas::model::ContinuousSpace in which the
+ * agent is moving. The specified space might be a class member, a static
+ * variable, or any other variable which lifetime exceeds the one of the
+ * current agent.
+ */
+#define FPMAS_CONTINUOUS_SPACE(SPACE)\
+	const fpmas::model::ContinuousSpace& continuousSpace() const override {return SPACE;}
+
+namespace fpmas { namespace model {
+	using api::model::ContinuousPoint;
+	using api::model::ContinuousCoordinate;
+
+	/**
+	 * Describes a 2D continuous space of size `width x height`, divided in
+	 * square _bins_ of size `bin_size`.
+	 *
+	 * Each bin is represented by a GridCell, so that the bin of coordinates
+	 * `(i, j)` covers the points of the continuous space such that
+	 * `i*bin_size <= x < (i+1)*bin_size` and `j*bin_size <= y <
+	 * (j+1)*bin_size`. The grid of bins can be built using the
+	 * ContinuousSpaceBuilder.
+	 *
+	 * Bins play the role of a distributed _cell list_: agents located in a
+	 * bin are directly available from the corresponding GridCell, and radius
+	 * queries only need to consider bins that intersect the query disk.
+	 */
+	class ContinuousSpace {
+		private:
+			ContinuousCoordinate _width;
+			ContinuousCoordinate _height;
+			ContinuousCoordinate bin_size;
+
+		public:
+			/**
+			 * ContinuousSpace constructor.
+			 *
+			 * @param width width of the space
+			 * @param height height of the space
+			 * @param bin_size size of a square bin. As a rule of thumb, bins
+			 * should be approximately as large as the maximum perception
+			 * radius of agents.
+			 */
+			ContinuousSpace(
+					ContinuousCoordinate width, ContinuousCoordinate height,
+					ContinuousCoordinate bin_size)
+				: _width(width), _height(height), bin_size(bin_size) {}
+
+			/**
+			 * Width of the space.
+			 */
+			ContinuousCoordinate width() const {return _width;}
+			/**
+			 * Height of the space.
+			 */
+			ContinuousCoordinate height() const {return _height;}
+			/**
+			 * Size of a square bin.
+			 */
+			ContinuousCoordinate binSize() const {return bin_size;}
+
+			/**
+			 * Count of bins in the x direction, i.e. the width of the grid
+			 * of bins.
+			 */
+			DiscreteCoordinate binWidth() const;
+			/**
+			 * Count of bins in the y direction, i.e. the height of the grid
+			 * of bins.
+			 */
+			DiscreteCoordinate binHeight() const;
+
+			/**
+			 * Returns true iff `point` is contained in `[0, width) x [0,
+			 * height)`.
+			 */
+			bool contains(const ContinuousPoint& point) const;
+
+			/**
+			 * Returns the coordinates of the bin that contains `point`.
+			 *
+			 * @param point point of the space
+			 * @return bin coordinates
+			 */
+			DiscretePoint bin(const ContinuousPoint& point) const;
+
+			/**
+			 * Returns the center of the specified `bin`.
+			 *
+			 * @param bin bin coordinates
+			 * @return center of the bin
+			 */
+			ContinuousPoint binCenter(const DiscretePoint& bin) const;
+
+			/**
+			 * Returns the minimum euclidian distance between any point of
+			 * `bin1` and any point of `bin2`.
+			 *
+			 * The distance is 0 if `bin1` and `bin2` are identical or
+			 * adjacent (including diagonals).
+			 */
+			ContinuousCoordinate binDistance(
+					const DiscretePoint& bin1, const DiscretePoint& bin2) const;
+
+			/**
+			 * Returns the maximum ChebyshevDistance between a bin `b` and
+			 * any bin `b'` such that `binDistance(b, b') <= radius`.
+			 *
+			 * This is `floor(radius/bin_size) + 1` if `radius >= 0`, and 0
+			 * otherwise.
+			 */
+			DiscreteCoordinate binRadius(ContinuousCoordinate radius) const;
+	};
+
+	/**
+	 * api::model::Range implementation for a ContinuousSpace.
+	 *
+	 * The range contains any bin that intersects the disk of radius
+	 * `radius` centered on any point of the origin bin, i.e. any bin `b` such
+	 * that `space.binDistance(origin, b) <= radius`. In consequence, it
+	 * contains all the agents which euclidian distance to any point of the
+	 * origin bin is less than or equal to `radius`, so that exact radius
+	 * queries can be performed filtering the perceptions of a
+	 * ContinuousAgent (see ContinuousAgent::perceptionsWithin()).
+	 *
+	 * The range radius assumes that bins are linked as a MooreGrid, what is
+	 * the case when the grid is built with the ContinuousSpaceBuilder.
+	 *
+	 * If `radius < 0`, the range is empty.
+	 *
+	 * @tparam CellType type of \GridCells used to represent bins
+	 */
+	template<typename CellType = model::GridCell>
+		class ContinuousRange : public api::model::Range<CellType> {
+			private:
+				const ContinuousSpace& space;
+				ContinuousCoordinate _radius;
+
+			public:
+				/**
+				 * ContinuousRange constructor.
+				 *
+				 * @param space continuous space, that must outlive this range
+				 * @param radius radius of the range
+				 */
+				ContinuousRange(const ContinuousSpace& space, ContinuousCoordinate radius)
+					: space(space), _radius(radius) {}
+
+				/**
+				 * Returns the radius of the range, in the units of the
+				 * continuous space.
+				 *
+				 * Not to be confused with radius(CellType*), that returns
+				 * the radius of the range in bins.
+				 */
+				ContinuousCoordinate getRadius() const {
+					return _radius;
+				}
+
+				/**
+				 * Sets the radius of the range, in the units of the
+				 * continuous space.
+				 */
+				void setRadius(ContinuousCoordinate radius) {
+					_radius = radius;
+				}
+
+				/**
+				 * Returns true iff `space.binDistance(location_cell->location(),
+				 * cell->location()) <= radius`.
+				 *
+				 * @param location_cell origin bin
+				 * @param cell bin to check
+				 */
+				bool contains(CellType* location_cell, CellType* cell) const override {
+					if(_radius < 0)
+						return false;
+					return space.binDistance(
+							location_cell->location(), cell->location()
+							) <= _radius;
+				}
+
+				/**
+				 * Returns `space.binRadius(radius)`.
+				 */
+				std::size_t radius(CellType*) const override {
+					return space.binRadius(_radius);
+				}
+		};
+
+	/**
+	 * MooreGridBuilder adapter that builds the grid of bins of a
+	 * ContinuousSpace.
+	 *
+	 * Bins are distributed as any other MooreGrid, so that all the
+	 * GridProcessMapping strategies (default TreeProcessMapping,
+	 * GridLoadBalancing...) can be used to decompose the continuous space.
+	 *
+	 * @tparam CellType type of \GridCells used to represent bins
+	 */
+	template<typename CellType = model::GridCell>
+		class ContinuousSpaceBuilder : public MooreGridBuilder<CellType> {
+			public:
+				/**
+				 * ContinuousSpaceBuilder constructor.
+				 *
+				 * @param cell_factory cell factory
+				 * @param space continuous space to build
+				 * @param topology_mode topology mode of the grid of bins
+				 */
+				ContinuousSpaceBuilder(
+						api::model::GridCellFactory<CellType>& cell_factory,
+						const ContinuousSpace& space,
+						GridTopologyMode topology_mode = EXPLICIT_TOPOLOGY)
+					: MooreGridBuilder<CellType>(
+							cell_factory, space.binWidth(), space.binHeight(),
+							topology_mode) {}
+
+				/**
+				 * ContinuousSpaceBuilder constructor.
+				 *
+				 * A default GridCellFactory is used.
+				 *
+				 * @param space continuous space to build
+				 * @param topology_mode topology mode of the grid of bins
+				 */
+				ContinuousSpaceBuilder(
+						const ContinuousSpace& space,
+						GridTopologyMode topology_mode = EXPLICIT_TOPOLOGY)
+					: MooreGridBuilder<CellType>(
+							space.binWidth(), space.binHeight(), topology_mode) {}
+		};
+
+	/**
+	 * GridAgent extension situated with real coordinates in a
+	 * ContinuousSpace.
+	 *
+	 * The agent is located on the bin (i.e. the GridCell) that contains its
+	 * position(). Moving within the current bin only updates the position of
+	 * the agent, without any graph operation, while crossing a bin border
+	 * is a regular GridAgent move, handled by the DistributedMoveAlgorithm.
+	 *
+	 * ContinuousRanges should be used as mobility and perception ranges. The
+	 * perception field then plays the role of a ghost halo of width
+	 * `perception_radius` around the agent: DISTANT agents located in this
+	 * halo are imported by the DistributedMoveAlgorithm, and their position
+	 * is synchronized by the current synchronization mode.
+	 *
+	 * Agents crossing subdomain boundaries are migrated in batches with their
+	 * bin when the model is balanced with a GridLoadBalancing or a
+	 * CellLoadBalancing.
+	 *
+	 * The continuousSpace() method must be defined by the user, for example
+	 * using the FPMAS_CONTINUOUS_SPACE() macro.
+	 *
+	 * @par Example
+	 * ```cpp
+	 * class UserAgent : public fpmas::model::ContinuousAgent<UserAgent> {
+	 * 	public:
+	 * 		static fpmas::model::ContinuousSpace space;
+	 * 		static fpmas::model::ContinuousRange<> range;
+	 *
+	 * 		FPMAS_CONTINUOUS_SPACE(space);
+	 * 		FPMAS_MOBILITY_RANGE(range);
+	 * 		FPMAS_PERCEPTION_RANGE(range);
+	 *
+	 * 		void behavior() {
+	 * 			for(auto neighbor : this->perceptionsWithin<UserAgent>(1.5)) {
+	 * 				...
+	 * 			}
+	 * 			this->moveTo(fpmas::model::ContinuousPoint(...));
+	 * 		}
+	 * };
+	 *
+	 * fpmas::model::ContinuousSpace UserAgent::space(100, 100, 2.);
+	 * fpmas::model::ContinuousRange<> UserAgent::range(UserAgent::space, 2.);
+	 * ```
+	 *
+	 * @tparam AgentType final ContinuousAgent type (i.e. the most derived
+	 * type from this ContinuousAgent)
+	 * @tparam GridCellType type of \GridCells used to represent bins
+	 * @tparam Derived direct derived class, or at least the next class in the
+	 * serialization chain
+	 */
+	template<typename AgentType, typename GridCellType = model::GridCell, typename Derived = AgentType>
+	class ContinuousAgent :
+		public GridAgent<AgentType, GridCellType, ContinuousAgent<AgentType, GridCellType, Derived>>,
+		public api::model::ContinuousAgentBase {
+			friend nlohmann::adl_serializer<api::utils::PtrWrapper<ContinuousAgent<AgentType, GridCellType, Derived>>>;
+			friend io::datapack::Serializer<api::utils::PtrWrapper<ContinuousAgent<AgentType, GridCellType, Derived>>>;
+			friend io::datapack::GhostSerializer<api::utils::PtrWrapper<ContinuousAgent<AgentType, GridCellType, Derived>>>;
+
+			private:
+			typedef GridAgent<AgentType, GridCellType, ContinuousAgent<AgentType, GridCellType, Derived>>
+				GridAgentBase;
+
+			ContinuousPoint _position {0, 0};
+
+			protected:
+			using GridAgentBase::moveTo;
+			/**
+			 * Moves to the specified bin.
+			 *
+			 * The position of the agent is preserved if it is contained in
+			 * the bin. Otherwise, it is set to the center of the bin.
+			 *
+			 * @param cell bin to move to
+			 */
+			void moveTo(GridCellType* cell) override;
+			/**
+			 * \copydoc fpmas::api::model::ContinuousAgentBase::moveTo
+			 */
+			void moveTo(ContinuousPoint point) override;
+
+			/**
+			 * Returns the perceived agents which euclidian distance to the
+			 * position of this agent is less than or equal to `radius`.
+			 *
+			 * Perceived agents that are not \ContinuousAgents are ignored.
+			 * All the agents within `radius` are returned provided that
+			 * `radius` is less than or equal to the radius of the perception
+			 * range, if it is a ContinuousRange.
+			 *
+			 * @tparam NeighborType type of perceived agents to return
+			 * @param radius query radius
+			 * @return list of perceived \Agents of type `NeighborType` within
+			 * `radius`
+			 */
+			template<typename NeighborType = api::model::Agent>
+				Neighbors<NeighborType> perceptionsWithin(ContinuousCoordinate radius) const;
+
+			public:
+			/**
+			 * Returns the ContinuousSpace in which the agent is moving.
+			 */
+			virtual const ContinuousSpace& continuousSpace() const = 0;
+
+			using GridAgentBase::initLocation;
+			/**
+			 * Initializes the location of this agent at the specified
+			 * `position`.
+			 *
+			 * `cell` must be the bin that contains `position`. Apart from
+			 * the position, the behavior is the same as
+			 * api::model::SpatialAgent::initLocation(Cell*).
+			 *
+			 * @param cell bin containing `position`
+			 * @param position initial position
+			 */
+			void initLocation(GridCellType* cell, ContinuousPoint position) {
+				_position = position;
+				this->initLocation(cell);
+			}
+
+			/**
+			 * \copydoc fpmas::api::model::ContinuousAgentBase::position
+			 */
+			ContinuousPoint position() const override {return _position;}
+		};
+
+	template<typename AgentType, typename GridCellType, typename Derived>
+		void ContinuousAgent<AgentType, GridCellType, Derived>::moveTo(GridCellType* cell) {
+			GridAgentBase::moveTo(cell);
+			if(continuousSpace().bin(_position) != cell->location())
+				_position = continuousSpace().binCenter(cell->location());
+		}
+
+	template<typename AgentType, typename GridCellType, typename Derived>
+		void ContinuousAgent<AgentType, GridCellType, Derived>::moveTo(ContinuousPoint point) {
+			DiscretePoint bin = continuousSpace().bin(point);
+			if(bin != this->locationPoint())
+				// Throws an OutOfMobilityFieldException if the bin is not in
+				// the mobility field
+				GridAgentBase::moveTo(bin);
+			// Moving within the current bin does not require any graph
+			// operation
+			_position = point;
+		}
+
+	template<typename AgentType, typename GridCellType, typename Derived>
+		template<typename NeighborType>
+		Neighbors<NeighborType> ContinuousAgent<AgentType, GridCellType, Derived>
+		::perceptionsWithin(ContinuousCoordinate radius) const {
+			std::vector<Neighbor<NeighborType>> out;
+			for(auto& neighbor : this->template perceptions<NeighborType>()) {
+				NeighborType* agent = neighbor;
+				fpmas::model::ReadGuard read(agent);
+				if(auto continuous_agent
+						= dynamic_cast<const api::model::ContinuousAgentBase*>(agent))
+					if(api::model::euclidian_distance(
+								_position, continuous_agent->position()
+								) <= radius)
+						out.push_back(neighbor);
+			}
+			return out;
+		}
+}}
+
+namespace nlohmann {
+	/**
+	 * nlohmann::adl_serializer specialization for
+	 * fpmas::api::model::ContinuousPoint.
+	 */
+	template<>
+		struct adl_serializer<fpmas::api::model::ContinuousPoint> {
+			/**
+			 * Serializes the specified point as `[<json.x>, <json.y>]`.
+			 *
+			 * @param j output json
+			 * @param point point to serialize
+			 */
+			static void to_json(nlohmann::json& j, const fpmas::api::model::ContinuousPoint& point) {
+				j = {point.x, point.y};
+			}
+			/**
+			 * Unserializes a ContinuousPoint from the input json.
+			 *
+			 * The input json must have the form `[x, y]`.
+			 *
+			 * @param j input json
+			 * @param point unserialized point
+			 */
+			static void from_json(const nlohmann::json& j, fpmas::api::model::ContinuousPoint& point) {
+				point.x = j[0].get<fpmas::api::model::ContinuousCoordinate>();
+				point.y = j[1].get<fpmas::api::model::ContinuousCoordinate>();
+			}
+		};
+
+	/**
+	 * Polymorphic ContinuousAgent nlohmann json serializer specialization.
+	 */
+	template<typename AgentType, typename CellType, typename Derived>
+		struct adl_serializer<fpmas::api::utils::PtrWrapper<fpmas::model::ContinuousAgent<AgentType, CellType, Derived>>> {
+			/**
+			 * Pointer wrapper to a polymorphic ContinuousAgent.
+			 */
+			typedef fpmas::api::utils::PtrWrapper<fpmas::model::ContinuousAgent<AgentType, CellType, Derived>> Ptr;
+
+			/**
+			 * Serializes the pointer to the polymorphic ContinuousAgent using
+			 * the following JSON schema:
+			 * ```json
+			 * [<Derived json serialization>, ptr->position()]
+			 * ```
+			 *
+			 * @param j json output
+			 * @param ptr pointer to a polymorphic ContinuousAgent to serialize
+			 */
+			static void to_json(nlohmann::json& j, const Ptr& ptr) {
+				// Derived serialization
+				j[0] = fpmas::api::utils::PtrWrapper<Derived>(
+						const_cast<Derived*>(static_cast<const Derived*>(ptr.get())));
+				// Current base serialization
+				j[1] = ptr->_position;
+			}
+
+			/**
+			 * Unserializes a polymorphic ContinuousAgent from the specified
+			 * Json.
+			 *
+			 * The `Derived` part is unserialized from `j[0]`, and the
+			 * position of the agent from `j[1]`.
+			 *
+			 * @param j json input
+			 * @return unserialized pointer to a polymorphic `ContinuousAgent`
+			 */
+			static Ptr from_json(const nlohmann::json& j) {
+				// Derived unserialization.
+				// The current base is implicitly default initialized
+				fpmas::api::utils::PtrWrapper<Derived> derived_ptr
+					= j[0].get<fpmas::api::utils::PtrWrapper<Derived>>();
+
+				// Initializes the current base
+				derived_ptr->_position = j[1].get<fpmas::api::model::ContinuousPoint>();
+				return derived_ptr.get();
+			}
+		};
+}
+
+namespace fpmas { namespace io { namespace json {
+	/**
+	 * light_serializer specialization for an fpmas::model::ContinuousAgent
+	 *
+	 * The light_serializer is directly call on the next `Derived` type: no
+	 * data is added to / extracted from the current \light_json.
+	 *
+	 * @tparam AgentType final \Agent type to serialize
+	 * @tparam CellType type of cells used by the spatial model
+	 * @tparam Derived next derived class in the polymorphic serialization
+	 * chain
+	 */
+	template<typename AgentType, typename CellType, typename Derived>
+		struct light_serializer<PtrWrapper<fpmas::model::ContinuousAgent<AgentType, CellType, Derived>>> {
+			/**
+			 * Pointer wrapper to a polymorphic ContinuousAgent.
+			 */
+			typedef PtrWrapper<fpmas::model::ContinuousAgent<AgentType, CellType, Derived>> Ptr;
+
+			/**
+			 * Effectively calls
+			 * `light_serializer<fpmas::api::utils::PtrWrapper<Derived>>::%to_json()`.
+			 *
+			 * @param j json output
+			 * @param agent continuous agent to serialize
+			 */
+			static void to_json(light_json& j, const Ptr& agent) {
+				light_serializer<PtrWrapper<Derived>>::to_json(
+						j,
+						const_cast<Derived*>(static_cast<const Derived*>(agent.get()))
+						);
+			}
+
+			/**
+			 * Effectively calls
+			 * `light_serializer<fpmas::api::utils::PtrWrapper<Derived>>::%from_json()`.
+			 *
+			 * @param j json input
+			 * @return dynamically allocated `Derived` instance, unserialized from `j`
+			 */
+			static Ptr from_json(const light_json& j) {
+				PtrWrapper<Derived> derived_ptr
+					= light_serializer<PtrWrapper<Derived>>::from_json(j);
+				return derived_ptr.get();
+			}
+		};
+}}}
+
+namespace fpmas { namespace io { namespace datapack {
+	/**
+	 * Polymorphic ContinuousAgent ObjectPack serializer specialization.
+	 *
+	 * | Serialization Scheme ||
+	 * |----------------------||
+	 * | `Derived` ObjectPack serialization | ContinuousAgent::position() |
+	 *
+	 * @tparam AgentType final fpmas::model::ContinuousAgent type to serialize
+	 * @tparam CellType type of cells used by the spatial model
+	 * @tparam Derived next derived class in the polymorphic serialization
+	 * chain
+	 */
+	template<typename AgentType, typename CellType, typename Derived>
+		struct Serializer<PtrWrapper<fpmas::model::ContinuousAgent<AgentType, CellType, Derived>>> {
+			/**
+			 * Pointer wrapper to a polymorphic ContinuousAgent.
+			 */
+			typedef PtrWrapper<fpmas::model::ContinuousAgent<AgentType, CellType, Derived>> Ptr;
+
+			/**
+			 * Returns the buffer size required to serialize the polymorphic
+			 * ContinuousAgent pointed by `ptr` into `p`.
+			 */
+			static std::size_t size(const ObjectPack& p, const Ptr& ptr) {
+				return p.size(PtrWrapper<Derived>(
+						const_cast<Derived*>(static_cast<const Derived*>(ptr.get()))))
+					+ p.size<fpmas::api::model::ContinuousPoint>();
+			}
+
+			/**
+			 * Serializes the pointer to the polymorphic ContinuousAgent into
+			 * the specified ObjectPack.
+			 *
+			 * @param pack destination ObjectPack
+			 * @param ptr pointer to a polymorphic ContinuousAgent to serialize
+			 */
+			static void to_datapack(ObjectPack& pack, const Ptr& ptr) {
+				// Derived serialization
+				PtrWrapper<Derived> derived = PtrWrapper<Derived>(
+						const_cast<Derived*>(static_cast<const Derived*>(ptr.get())));
+				pack.put(derived);
+				// Current base serialization
+				pack.put(ptr->_position);
+			}
+
+			/**
+			 * Unserializes a polymorphic ContinuousAgent from the specified
+			 * ObjectPack.
+			 *
+			 * @param pack source ObjectPack
+			 * @return unserialized pointer to a polymorphic `ContinuousAgent`
+			 */
+			static Ptr from_datapack(const ObjectPack& pack) {
+				// Derived unserialization.
+				// The current base is implicitly default initialized
+				PtrWrapper<Derived> derived_ptr = pack
+					.get<PtrWrapper<Derived>>();
+
+				// Initializes the current base
+				derived_ptr->_position = pack.get<fpmas::api::model::ContinuousPoint>();
+				return derived_ptr.get();
+			}
+
+			/**
+			 * Unserializes a polymorphic ContinuousAgent from the specified
+			 * ObjectPack directly into the existing ContinuousAgent pointed
+			 * by `ptr`.
+			 *
+			 * @param pack source ObjectPack
+			 * @param ptr pointer to the ContinuousAgent to update
+			 */
+			static void update_datapack(const ObjectPack& pack, Ptr ptr) {
+				AgentUpdate<ObjectPack, Derived>::update(
+						pack, static_cast<Derived*>(ptr.get()));
+				ptr->_position = pack.get<fpmas::api::model::ContinuousPoint>();
+			}
+		};
+
+	/**
+	 * Polymorphic ContinuousAgent GhostSerializer specialization.
+	 *
+	 * | Serialization Scheme ||
+	 * |----------------------||
+	 * | `Derived` ghost serialization | ContinuousAgent::position() |
+	 *
+	 * The position is always required by ghost agents, since it is used by
+	 * radius queries.
+	 *
+	 * @tparam AgentType final fpmas::model::ContinuousAgent type to serialize
+	 * @tparam CellType type of cells used by the spatial model
+	 * @tparam Derived next derived class in the polymorphic serialization
+	 * chain
+	 */
+	template<typename AgentType, typename CellType, typename Derived>
+		struct GhostSerializer<PtrWrapper<fpmas::model::ContinuousAgent<AgentType, CellType, Derived>>> {
+			/**
+			 * Pointer wrapper to a polymorphic ContinuousAgent.
+			 */
+			typedef PtrWrapper<fpmas::model::ContinuousAgent<AgentType, CellType, Derived>> Ptr;
+
+			/**
+			 * Returns the buffer size required to serialize the ghost part
+			 * of the polymorphic ContinuousAgent pointed by `ptr` into `p`.
+			 */
+			static std::size_t size(const ObjectPack& p, const Ptr& ptr) {
+				return AgentGhostSerializer<Derived>::size(p, PtrWrapper<Derived>(
+							const_cast<Derived*>(static_cast<const Derived*>(ptr.get()))))
+					+ p.size<fpmas::api::model::ContinuousPoint>();
+			}
+
+			/**
+			 * Serializes the ghost part of the polymorphic ContinuousAgent
+			 * into the specified ObjectPack.
+			 *
+			 * @param pack destination ObjectPack
+			 * @param ptr pointer to a polymorphic ContinuousAgent to serialize
+			 */
+			static void to_datapack(ObjectPack& pack, const Ptr& ptr) {
+				AgentGhostSerializer<Derived>::to_datapack(pack, PtrWrapper<Derived>(
+							const_cast<Derived*>(static_cast<const Derived*>(ptr.get()))));
+				pack.put(ptr->_position);
+			}
+
+			/**
+			 * Unserializes ghost data into the existing polymorphic
+			 * ContinuousAgent pointed by `ptr`.
+			 *
+			 * @param pack source ObjectPack
+			 * @param ptr pointer to the ContinuousAgent to update
+			 */
+			static void update_datapack(const ObjectPack& pack, Ptr ptr) {
+				AgentGhostSerializer<Derived>::update_datapack(pack, PtrWrapper<Derived>(
+							static_cast<Derived*>(ptr.get())));
+				ptr->_position = pack.get<fpmas::api::model::ContinuousPoint>();
+			}
+		};
+
+	/**
+	 * LightSerializer specialization for an fpmas::model::ContinuousAgent
+	 *
+	 * The LightSerializer is directly call on the next `Derived` type: no
+	 * data is added to / extracted from the current LightObjectPack.
+	 *
+	 * @tparam AgentType final fpmas::model::ContinuousAgent type to serialize
+	 * @tparam CellType type of cells used by the spatial model
+	 * @tparam Derived next derived class in the polymorphic serialization
+	 * chain
+	 */
+	template<typename AgentType, typename CellType, typename Derived>
+		struct LightSerializer<PtrWrapper<fpmas::model::ContinuousAgent<AgentType, CellType, Derived>>> {
+			/**
+			 * Pointer wrapper to a polymorphic ContinuousAgent.
+			 */
+			typedef PtrWrapper<fpmas::model::ContinuousAgent<AgentType, CellType, Derived>> Ptr;
+
+			/**
+			 * Returns the buffer size required to serialize the `Derived`
+			 * part of `ptr`.
+			 */
+			static std::size_t size(const LightObjectPack& p, const Ptr& ptr) {
+				return p.size(PtrWrapper<Derived>(
+						const_cast<Derived*>(static_cast<const Derived*>(ptr.get()))
+						));
+			}
+
+			/**
+			 * Effectively calls
+			 * `LightSerializer<fpmas::api::utils::PtrWrapper<Derived>>::%to_datapack()`.
+			 *
+			 * @param pack destination LightObjectPack
+			 * @param agent continuous agent to serialize
+			 */
+			static void to_datapack(LightObjectPack& pack, const Ptr& agent) {
+				LightSerializer<PtrWrapper<Derived>>::to_datapack(
+						pack,
+						const_cast<Derived*>(static_cast<const Derived*>(agent.get()))
+						);
+			}
+
+			/**
+			 * Effectively calls
+			 * `LightSerializer<fpmas::api::utils::PtrWrapper<Derived>>::%from_datapack()`.
+			 *
+			 * @param pack source LightObjectPack
+			 * @return dynamically allocated `Derived` instance, unserialized from `pack`
+			 */
+			static Ptr from_datapack(const LightObjectPack& pack) {
+				PtrWrapper<Derived> derived_ptr
+					= LightSerializer<PtrWrapper<Derived>>::from_datapack(pack);
+				return derived_ptr.get();
+			}
+		};
+
+	/**
+	 * ContinuousPoint is_trivially_serializable specialization, so that
+	 * containers of ContinuousPoints are serialized in bulk.
+	 */
+	template<>
+		struct is_trivially_serializable<api::model::ContinuousPoint>
+		: public std::true_type {
+		};
+
+	/**
+	 * ContinuousPoint base_io specialization.
+	 *
+	 * | Serialization scheme ||
+	 * | point.x | point.y |
+	 */
+	template<>
+		struct Serializer<api::model::ContinuousPoint> {
+			/**
+			 * Returns the buffer size, in bytes, required to serialize a
+			 * ContinuousPoint instance in a DataPack, i.e.
+			 * `2*%p.size<ContinuousCoordinate>()`.
+			 */
+			static std::size_t size(const ObjectPack& p);
+
+			/**
+			 * Equivalent to size().
+			 */
+			static std::size_t size(const ObjectPack& p, const api::model::ContinuousPoint&);
+
+			/**
+			 * Writes `point` to the `pack` buffer.
+			 *
+			 * @param pack destination ObjectPack
+			 * @param point source point
+			 */
+			static void to_datapack(
+					ObjectPack& pack, const api::model::ContinuousPoint& point);
+
+			/**
+			 * Reads a ContinuousPoint from the `pack` buffer.
+			 *
+			 * @param pack source ObjectPack
+			 * @return read ContinuousPoint
+			 */
+			static api::model::ContinuousPoint from_datapack(const ObjectPack& pack);
+		};
+}}}
+#endif
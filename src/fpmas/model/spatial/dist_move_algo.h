@@ -221,6 +221,15 @@ namespace fpmas { namespace model {
 					dist_move_algo.model.graph().unlink(perceiver);
 				}
 			}
+			// PERCEPTION edges of agents that query their perceptions are
+			// rebuilt at each execution, since they depend on the current
+			// distribution of cells
+			for(auto agent : dist_move_algo.move_agent_group.localAgents())
+				if(static_cast<SpatialAgent<CellType>*>(agent)->perceptionMode()
+						== api::model::QUERIED_PERCEPTIONS)
+					for(auto perception : agent->node()->getOutgoingEdges(
+								api::model::SpatialModelLayers::PERCEPTION))
+						dist_move_algo.model.graph().unlink(perception);
 			// Commits unlinks
 			dist_move_algo.model.graph()
 				.synchronizationMode().getSyncLinker().synchronize();
@@ -477,6 +477,87 @@ namespace fpmas { namespace io { namespace datapack {
 
 				return derived_ptr.get();
 			}
+
+			/**
+			 * Unserializes a polymorphic GraphCellBase from the specified
+			 * ObjectPack directly into the existing GraphCellBase pointed by
+			 * `ptr`.
+			 *
+			 * The `Derived` part is updated using the AgentUpdate<ObjectPack,
+			 * Derived> helper, so that no temporary instance is allocated if
+			 * `Derived` supports in place updates.
+			 *
+			 * @param pack source ObjectPack
+			 * @param ptr pointer to the GraphCellBase to update
+			 */
+			static void update_datapack(const ObjectPack& pack, Ptr ptr) {
+				AgentUpdate<ObjectPack, Derived>::update(
+						pack, dynamic_cast<Derived*>(ptr.get()));
+				static_cast<fpmas::model::ReachableCell&>(*ptr)
+					= pack.get<fpmas::model::ReachableCell>();
+			}
+		};
+
+	/**
+	 * Polymorphic GraphCellBase GhostSerializer specialization.
+	 *
+	 * | Serialization Scheme ||
+	 * |----------------------||
+	 * | `Derived` ghost serialization | ReachableCell ObjectPack serialization |
+	 *
+	 * The ReachableCell part is required by ghost cells, so it is fully
+	 * serialized. The `Derived` part is serialized using the
+	 * AgentGhostSerializer<Derived> helper, that falls back to the regular
+	 * Serializer<PtrWrapper<Derived>> if no ghost serialization rules are
+	 * defined for `Derived`.
+	 *
+	 * @tparam GraphCellType final fpmas::model::GraphCellBase type to serialize
+	 * @tparam Derived next derived class in the polymorphic serialization
+	 * chain
+	 */
+	template<typename GraphCellType, typename Derived>
+		struct GhostSerializer<PtrWrapper<fpmas::model::GraphCellBase<GraphCellType, Derived>>> {
+			/**
+			 * Pointer wrapper to a polymorphic GraphCellBase.
+			 */
+			typedef PtrWrapper<fpmas::model::GraphCellBase<GraphCellType, Derived>> Ptr;
+
+			/**
+			 * Returns the buffer size required to serialize the ghost part
+			 * of the GraphCellBase pointed to by `ptr` in `p`.
+			 */
+			static std::size_t size(const ObjectPack& p, const Ptr& ptr) {
+				return AgentGhostSerializer<Derived>::size(p, PtrWrapper<Derived>(
+							const_cast<Derived*>(dynamic_cast<const Derived*>(ptr.get()))))
+					+ p.size(static_cast<const fpmas::model::ReachableCell&>(*ptr));
+			}
+
+			/**
+			 * Serializes the ghost part of the polymorphic GraphCellBase
+			 * into the specified ObjectPack.
+			 *
+			 * @param pack destination ObjectPack
+			 * @param ptr pointer to a polymorphic GraphCellBase to serialize
+			 */
+			static void to_datapack(ObjectPack& pack, const Ptr& ptr) {
+				AgentGhostSerializer<Derived>::to_datapack(pack, PtrWrapper<Derived>(
+							const_cast<Derived*>(dynamic_cast<const Derived*>(ptr.get()))));
+				pack.put(static_cast<const fpmas::model::ReachableCell&>(*ptr));
+			}
+
+			/**
+			 * Unserializes ghost data into the existing polymorphic
+			 * GraphCellBase pointed by `ptr`.
+			 *
+			 * @param pack source ObjectPack
+			 * @param ptr pointer to the GraphCellBase to update
+			 */
+			static void update_datapack(const ObjectPack& pack, Ptr ptr) {
+				AgentGhostSerializer<Derived>::update_datapack(pack, PtrWrapper<Derived>(
+							dynamic_cast<Derived*>(ptr.get())));
+				static_cast<fpmas::model::ReachableCell&>(*ptr)
+					= pack.get<fpmas::model::ReachableCell>();
+			}
 		};
 
 
@@ -37,7 +37,125 @@ namespace fpmas { namespace model {
 		 */
 		std::size_t operator()(const DiscretePoint& p) const;
 	};
-		
+
+	/**
+	 * Enum describing how the successors of \GridCells are represented.
+	 */
+	enum GridTopologyMode {
+		/**
+		 * Successors are represented as CELL_SUCCESSOR edges between cells.
+		 */
+		EXPLICIT_TOPOLOGY,
+		/**
+		 * Successors are computed from cell coordinates and a
+		 * LocalGridTopology. Only CELL_SUCCESSOR edges between \LOCAL cells
+		 * and their \DISTANT frontier are built.
+		 */
+		IMPLICIT_TOPOLOGY
+	};
+
+	/**
+	 * Dense representation of the part of a grid available on the current
+	 * process.
+	 *
+	 * The topology covers a rectangular block of the global grid, that
+	 * typically contains the \LOCAL cells built on the current process and
+	 * the \DISTANT cells of their frontier. Cells are stored in a row-major
+	 * array indexed by their coordinates, so that the successors of a cell
+	 * can be computed arithmetically from its location and from a set of
+	 * neighborhood offsets, without any CELL_SUCCESSOR edge.
+	 *
+	 * @tparam GridCellType type of cells stored in the topology
+	 */
+	template<typename GridCellType>
+		class LocalGridTopology {
+			private:
+				DiscretePoint origin;
+				DiscreteCoordinate width;
+				DiscreteCoordinate height;
+				std::vector<DiscretePoint> neighborhood;
+				std::vector<GridCellType*> cells;
+
+				bool contains(const DiscretePoint& point) const {
+					return point.x >= origin.x && point.x < origin.x + width
+						&& point.y >= origin.y && point.y < origin.y + height;
+				}
+
+				std::size_t index(const DiscretePoint& point) const {
+					return (point.y - origin.y) * width + (point.x - origin.x);
+				}
+
+			public:
+				/**
+				 * LocalGridTopology constructor.
+				 *
+				 * All the cells of the block are initially undefined.
+				 *
+				 * @param origin bottom left corner of the block
+				 * @param extent point until which the block extends, i.e. the
+				 * top right corner of the block is at `extent-(1, 1)`
+				 * @param neighborhood offsets that, added to the location of a
+				 * cell, give the location of its successors
+				 */
+				LocalGridTopology(
+						DiscretePoint origin, DiscretePoint extent,
+						std::vector<DiscretePoint> neighborhood)
+					:
+						origin(origin),
+						width(std::max(extent.x - origin.x, DiscreteCoordinate(0))),
+						height(std::max(extent.y - origin.y, DiscreteCoordinate(0))),
+						neighborhood(neighborhood),
+						cells(width * height, nullptr) {
+					}
+
+				/**
+				 * Sets the cell located at `point`.
+				 *
+				 * Nothing is done if `point` is not contained in the block.
+				 *
+				 * @param point cell location
+				 * @param cell cell located at `point`
+				 */
+				void setCell(const DiscretePoint& point, GridCellType* cell) {
+					if(contains(point))
+						cells[index(point)] = cell;
+				}
+
+				/**
+				 * Returns the cell located at `point`.
+				 *
+				 * @param point cell location
+				 * @return cell located at `point`, or `nullptr` if `point` is
+				 * not contained in the block or if no cell was set at this
+				 * location
+				 */
+				GridCellType* cell(const DiscretePoint& point) const {
+					if(contains(point))
+						return cells[index(point)];
+					return nullptr;
+				}
+
+				/**
+				 * Appends the successors of the cell located at `point` to
+				 * `successors`.
+				 *
+				 * Successors are the defined cells located at `point + offset`
+				 * for each offset of the neighborhood, in the neighborhood
+				 * order.
+				 *
+				 * @param point cell location
+				 * @param successors output successors list
+				 */
+				void successors(
+						const DiscretePoint& point,
+						std::vector<GridCellType*>& successors) const {
+					for(auto& offset : neighborhood)
+						if(GridCellType* cell = this->cell(
+									{point.x + offset.x, point.y + offset.y}))
+							successors.push_back(cell);
+				}
+		};
+
 	/**
 	 * api::model::GridCell implementation.
 	 *
@@ -51,10 +169,28 @@ namespace fpmas { namespace model {
 		public CellBase<api::model::GridCell, GridCellType, GridCellBase<GridCellType, Derived>> {
 		friend nlohmann::adl_serializer<fpmas::api::utils::PtrWrapper<GridCellBase<GridCellType, Derived>>>;
 		friend io::datapack::Serializer<fpmas::api::utils::PtrWrapper<GridCellBase<GridCellType, Derived>>>;
+		friend io::datapack::GhostSerializer<fpmas::api::utils::PtrWrapper<GridCellBase<GridCellType, Derived>>>;
 
 		private:
 			DiscretePoint _location;
 			random::FPMAS_AGENT_RNG _rd;
+			std::shared_ptr<const LocalGridTopology<GridCellType>> topology;
+
+		protected:
+			/**
+			 * If a LocalGridTopology has been attached to this cell,
+			 * successors are computed from the topology and the location of
+			 * the cell. Otherwise, CELL_SUCCESSOR edges are used.
+			 *
+			 * @param successors output successors list
+			 * @return true iff a LocalGridTopology is attached to this cell
+			 */
+			bool implicitSuccessors(std::vector<GridCellType*>& successors) override {
+				if(!topology)
+					return false;
+				topology->successors(_location, successors);
+				return true;
+			}
 
 		public:
 			/**
@@ -75,6 +211,51 @@ namespace fpmas { namespace model {
 			GridCellBase(DiscretePoint location)
 				: _location(location) {}
 
+			/**
+			 * Auto generated copy constructor.
+			 */
+			GridCellBase(const GridCellBase&) = default;
+			/**
+			 * Auto generated move constructor.
+			 */
+			GridCellBase(GridCellBase&&) = default;
+			/**
+			 * Auto generated copy assignment operator.
+			 */
+			GridCellBase& operator=(const GridCellBase&) = default;
+
+			/**
+			 * Move assignment operator.
+			 *
+			 * The location and the random generator are moved from `other`,
+			 * but the LocalGridTopology attached to this cell, if any, is
+			 * preserved, since it only makes sense on the current process.
+			 */
+			GridCellBase& operator=(GridCellBase&& other) {
+				CellBase<api::model::GridCell, GridCellType, GridCellBase<GridCellType, Derived>>
+					::operator=(std::move(other));
+				_location = other._location;
+				_rd = std::move(other._rd);
+				return *this;
+			}
+
+			/**
+			 * Attaches a LocalGridTopology to this cell, so that its
+			 * successors are computed from the topology instead of from
+			 * CELL_SUCCESSOR edges.
+			 *
+			 * Pointers to cells stored in the topology must remain valid as
+			 * long as the topology is attached, what requires the grid
+			 * distribution to be static.
+			 *
+			 * @param topology local grid topology, that might be shared by all
+			 * cells of the current process
+			 */
+			void setGridTopology(
+					std::shared_ptr<const LocalGridTopology<GridCellType>> topology) {
+				this->topology = topology;
+			}
+
 			/**
 			 * \copydoc fpmas::api::model::GridCell::location
 			 */
@@ -121,6 +302,7 @@ namespace fpmas { namespace model {
 		public SpatialAgentBase<api::model::GridAgent<GridCellType>, AgentType, GridCellType, GridAgent<AgentType, GridCellType, Derived>> {
 			friend nlohmann::adl_serializer<api::utils::PtrWrapper<GridAgent<AgentType, GridCellType, Derived>>>;
 			friend io::datapack::Serializer<api::utils::PtrWrapper<GridAgent<AgentType, GridCellType, Derived>>>;
+			friend io::datapack::GhostSerializer<api::utils::PtrWrapper<GridAgent<AgentType, GridCellType, Derived>>>;
 			static_assert(std::is_base_of<api::model::GridCell, GridCellType>::value,
 					"The specified GridCellType must extend api::model::GridCell.");
 
@@ -1083,6 +1265,25 @@ namespace fpmas { namespace io { namespace datapack {
 				derived_ptr->_rd = pack.get<fpmas::random::FPMAS_AGENT_RNG>();
 				return derived_ptr.get();
 			}
+
+			/**
+			 * Unserializes a polymorphic GridCellBase from the specified
+			 * ObjectPack directly into the existing GridCellBase pointed by
+			 * `ptr`.
+			 *
+			 * The `Derived` part is updated using the AgentUpdate<ObjectPack,
+			 * Derived> helper, so that no temporary instance is allocated if
+			 * `Derived` supports in place updates.
+			 *
+			 * @param pack source ObjectPack
+			 * @param ptr pointer to the GridCellBase to update
+			 */
+			static void update_datapack(const ObjectPack& pack, Ptr ptr) {
+				AgentUpdate<ObjectPack, Derived>::update(
+						pack, static_cast<Derived*>(ptr.get()));
+				ptr->_location = pack.get<fpmas::api::model::DiscretePoint>();
+				ptr->_rd = pack.get<fpmas::random::FPMAS_AGENT_RNG>();
+			}
 		};
 
 	/**
@@ -1168,6 +1369,148 @@ namespace fpmas { namespace io { namespace datapack {
 				derived_ptr->_rd = pack.get<fpmas::random::FPMAS_AGENT_RNG>();
 				return derived_ptr.get();
 			}
+
+			/**
+			 * Unserializes a polymorphic GridAgent from the specified
+			 * ObjectPack directly into the existing GridAgent pointed by
+			 * `ptr`.
+			 *
+			 * The `Derived` part is updated using the AgentUpdate<ObjectPack,
+			 * Derived> helper, so that no temporary instance is allocated if
+			 * `Derived` supports in place updates.
+			 *
+			 * @param pack source ObjectPack
+			 * @param ptr pointer to the GridAgent to update
+			 */
+			static void update_datapack(const ObjectPack& pack, Ptr ptr) {
+				AgentUpdate<ObjectPack, Derived>::update(
+						pack, static_cast<Derived*>(ptr.get()));
+				ptr->location_point = pack.get<fpmas::api::model::DiscretePoint>();
+				ptr->_rd = pack.get<fpmas::random::FPMAS_AGENT_RNG>();
+			}
+		};
+
+	/**
+	 * Polymorphic GridCellBase GhostSerializer specialization.
+	 *
+	 * | Serialization Scheme ||
+	 * |----------------------||
+	 * | `Derived` ghost serialization | GridCellBase::location() |
+	 *
+	 * The internal random number generator is not required by ghost cells,
+	 * so it is not serialized. The `Derived` part is serialized using the
+	 * AgentGhostSerializer<Derived> helper, that falls back to the regular
+	 * Serializer<PtrWrapper<Derived>> if no ghost serialization rules are
+	 * defined for `Derived`.
+	 *
+	 * @tparam GridCellType final fpmas::api::model::GridCell type to serialize
+	 * @tparam Derived next derived class in the polymorphic serialization
+	 * chain
+	 */
+	template<typename GridCellType, typename Derived>
+		struct GhostSerializer<PtrWrapper<fpmas::model::GridCellBase<GridCellType, Derived>>> {
+			/**
+			 * Pointer wrapper to a polymorphic GridCellBase.
+			 */
+			typedef PtrWrapper<fpmas::model::GridCellBase<GridCellType, Derived>> Ptr;
+
+			/**
+			 * Returns the buffer size required to serialize the ghost part
+			 * of the GridCellBase pointed by `ptr` in `p`.
+			 */
+			static std::size_t size(const ObjectPack& p, const Ptr& ptr) {
+				return AgentGhostSerializer<Derived>::size(p, PtrWrapper<Derived>(
+							const_cast<Derived*>(static_cast<const Derived*>(ptr.get()))))
+					+ p.size<api::model::DiscretePoint>();
+			}
+
+			/**
+			 * Serializes the ghost part of the polymorphic GridCellBase into
+			 * the specified ObjectPack.
+			 *
+			 * @param pack destination ObjectPack
+			 * @param ptr pointer to a polymorphic GridCellBase to serialize
+			 */
+			static void to_datapack(ObjectPack& pack, const Ptr& ptr) {
+				AgentGhostSerializer<Derived>::to_datapack(pack, PtrWrapper<Derived>(
+							const_cast<Derived*>(static_cast<const Derived*>(ptr.get()))));
+				pack.put(ptr->_location);
+			}
+
+			/**
+			 * Unserializes ghost data into the existing polymorphic
+			 * GridCellBase pointed by `ptr`.
+			 *
+			 * @param pack source ObjectPack
+			 * @param ptr pointer to the GridCellBase to update
+			 */
+			static void update_datapack(const ObjectPack& pack, Ptr ptr) {
+				AgentGhostSerializer<Derived>::update_datapack(pack, PtrWrapper<Derived>(
+							static_cast<Derived*>(ptr.get())));
+				ptr->_location = pack.get<fpmas::api::model::DiscretePoint>();
+			}
+		};
+
+	/**
+	 * Polymorphic GridAgent GhostSerializer specialization.
+	 *
+	 * | Serialization Scheme ||
+	 * |----------------------||
+	 * | `Derived` ghost serialization | GridAgent::locationPoint() |
+	 *
+	 * The internal random number generator is not required by ghost
+	 * agents, so it is not serialized. The `Derived` part is serialized
+	 * using the AgentGhostSerializer<Derived> helper, that falls back to the
+	 * regular Serializer<PtrWrapper<Derived>> if no ghost serialization
+	 * rules are defined for `Derived`.
+	 *
+	 * @tparam AgentType final fpmas::api::model::GridAgent type to serialize
+	 * @tparam CellType type of cells used by the spatial model
+	 * @tparam Derived next derived class in the polymorphic serialization
+	 * chain
+	 */
+	template<typename AgentType, typename CellType, typename Derived>
+		struct GhostSerializer<PtrWrapper<fpmas::model::GridAgent<AgentType, CellType, Derived>>> {
+			/**
+			 * Pointer wrapper to a polymorphic GridAgent.
+			 */
+			typedef PtrWrapper<fpmas::model::GridAgent<AgentType, CellType, Derived>> Ptr;
+
+			/**
+			 * Returns the buffer size required to serialize the ghost part
+			 * of the polymorphic GridAgent pointed by `ptr` into `p`.
+			 */
+			static std::size_t size(const ObjectPack& p, const Ptr& ptr) {
+				return AgentGhostSerializer<Derived>::size(p, PtrWrapper<Derived>(
+							const_cast<Derived*>(static_cast<const Derived*>(ptr.get()))))
+					+ p.size<fpmas::api::model::DiscretePoint>();
+			}
+
+			/**
+			 * Serializes the ghost part of the polymorphic GridAgent into
+			 * the specified ObjectPack.
+			 *
+			 * @param pack destination ObjectPack
+			 * @param ptr pointer to a polymorphic GridAgent to serialize
+			 */
+			static void to_datapack(ObjectPack& pack, const Ptr& ptr) {
+				AgentGhostSerializer<Derived>::to_datapack(pack, PtrWrapper<Derived>(
+							const_cast<Derived*>(static_cast<const Derived*>(ptr.get()))));
+				pack.put(ptr->location_point);
+			}
+
+			/**
+			 * Unserializes ghost data into the existing polymorphic
+			 * GridAgent pointed by `ptr`.
+			 *
+			 * @param pack source ObjectPack
+			 * @param ptr pointer to the GridAgent to update
+			 */
+			static void update_datapack(const ObjectPack& pack, Ptr ptr) {
+				AgentGhostSerializer<Derived>::update_datapack(pack, PtrWrapper<Derived>(
+							static_cast<Derived*>(ptr.get())));
+				ptr->location_point = pack.get<fpmas::api::model::DiscretePoint>();
+			}
 		};
 
 	/**
@@ -1327,6 +1670,15 @@ namespace fpmas { namespace io { namespace datapack {
 			}
 		};
 
+	/**
+	 * DiscretePoint is_trivially_serializable specialization, so that
+	 * containers of DiscretePoints are serialized in bulk.
+	 */
+	template<>
+		struct is_trivially_serializable<api::model::DiscretePoint>
+		: public std::true_type {
+		};
+
 	/**
 	 * DiscretePoint base_io specialization.
 	 *
@@ -16,6 +16,55 @@ namespace fpmas { namespace model { namespace detail {
 	 */
 	typedef random::Index<DiscretePoint> GridCellIndex;
 
+	/**
+	 * Helper used to attach a LocalGridTopology to \GridCells.
+	 *
+	 * Only GridCellBase extensions support a LocalGridTopology: for any other
+	 * api::model::GridCell implementation, `value` is false and attach() has
+	 * no effect.
+	 *
+	 * @tparam CellType type of cells built by a GridBuilder
+	 */
+	template<typename CellType>
+		struct GridTopologySupport {
+			private:
+				template<typename Derived>
+					static std::true_type test(GridCellBase<CellType, Derived>*);
+				static std::false_type test(...);
+
+			public:
+				/**
+				 * True iff `CellType` supports a LocalGridTopology.
+				 */
+				static const bool value
+					= decltype(test(std::declval<CellType*>()))::value;
+
+				/**
+				 * Attaches `topology` to the specified GridCellBase.
+				 *
+				 * @param cell cell to which the topology is attached
+				 * @param topology local grid topology
+				 */
+				template<typename Derived>
+					static void attach(
+							GridCellBase<CellType, Derived>* cell,
+							const std::shared_ptr<const LocalGridTopology<CellType>>& topology) {
+						cell->setGridTopology(topology);
+					}
+
+				/**
+				 * Does nothing, since the specified cell is not a
+				 * GridCellBase.
+				 */
+				static void attach(
+						api::model::GridCell*,
+						const std::shared_ptr<const LocalGridTopology<CellType>>&) {
+				}
+		};
+
+	template<typename CellType>
+		const bool GridTopologySupport<CellType>::value;
+
 	/**
 	 * Grid builder base class.
 	 *
@@ -40,6 +89,7 @@ namespace fpmas { namespace model { namespace detail {
 				api::model::GridCellFactory<CellType>& cell_factory;
 				DiscreteCoordinate _width;
 				DiscreteCoordinate _height;
+				GridTopologyMode topology_mode;
 
 				mutable std::map<DiscretePoint, std::size_t> built_cells;
 				mutable GridCellIndex cell_begin {&built_cells};
@@ -128,6 +178,25 @@ namespace fpmas { namespace model { namespace detail {
 						std::vector<CellType*>& frontier
 						) const = 0;
 
+				/**
+				 * Offsets that, added to the location of a cell, give the
+				 * location of its successors.
+				 *
+				 * Offsets are used to compute successors in the
+				 * IMPLICIT_TOPOLOGY mode. The default implementation returns
+				 * an empty neighborhood, in which case the grid is always
+				 * built using the EXPLICIT_TOPOLOGY mode.
+				 *
+				 * Offsets must be contained in the Moore neighborhood of
+				 * the origin, since only the direct frontier of the local
+				 * grid is available on each process.
+				 *
+				 * @return neighborhood offsets
+				 */
+				virtual std::vector<DiscretePoint> neighborhood() const {
+					return {};
+				}
+
 			public:
 
 				/**
@@ -142,16 +211,28 @@ namespace fpmas { namespace model { namespace detail {
 				 * custom GridCell extensions (with extra user defined behaviors for
 				 * example).
 				 *
+				 * In the IMPLICIT_TOPOLOGY mode, successors of \LOCAL cells are
+				 * computed from their coordinates using a LocalGridTopology
+				 * shared by all the cells of the current process, and no
+				 * CELL_SUCCESSOR edge is built between \LOCAL cells. This
+				 * requires `CellType` to extend GridCellBase (the
+				 * EXPLICIT_TOPOLOGY mode is used otherwise), and the grid
+				 * distribution to remain static, since cells are not allowed
+				 * to migrate once the topology is built.
+				 *
 				 * @param cell_factory custom cell factory, that will be used
 				 * instead of default_cell_factory
 				 * @param width width of the grid
 				 * @param height height of the grid
+				 * @param topology_mode representation of cell successors
 				 */
 				GridBuilder(
 					api::model::GridCellFactory<CellType>& cell_factory,
 					DiscreteCoordinate width,
-					DiscreteCoordinate height)
-				: cell_factory(cell_factory), _width(width), _height(height) {
+					DiscreteCoordinate height,
+					GridTopologyMode topology_mode = EXPLICIT_TOPOLOGY)
+				: cell_factory(cell_factory), _width(width), _height(height),
+				topology_mode(topology_mode) {
 
 				}
 
@@ -162,11 +243,13 @@ namespace fpmas { namespace model { namespace detail {
 				 *
 				 * @param width width of the grid
 				 * @param height height of the grid
+				 * @param topology_mode representation of cell successors
 				 */
 				GridBuilder(
 						DiscreteCoordinate width,
-						DiscreteCoordinate height)
-					: GridBuilder(default_cell_factory, width, height) {
+						DiscreteCoordinate height,
+						GridTopologyMode topology_mode = EXPLICIT_TOPOLOGY)
+					: GridBuilder(default_cell_factory, width, height, topology_mode) {
 
 					}
 
@@ -182,6 +265,12 @@ namespace fpmas { namespace model { namespace detail {
 				DiscreteCoordinate height() const {
 					return _height;
 				}
+				/**
+				 * Representation of cell successors.
+				 */
+				GridTopologyMode topologyMode() const {
+					return topology_mode;
+				}
 
 				/**
 				 * Builds a grid into the specified `spatial_model`, according
@@ -411,8 +500,14 @@ namespace fpmas { namespace model { namespace detail {
 				model, local_dimensions, groups
 				);
 
-		// Build local links
-		buildLocalGrid(model, local_dimensions, cells);
+		std::vector<DiscretePoint> implicit_neighborhood;
+		if(topology_mode == IMPLICIT_TOPOLOGY && GridTopologySupport<CellType>::value)
+			implicit_neighborhood = neighborhood();
+
+		// Build local links, only required if successors can't be computed
+		// implicitly
+		if(implicit_neighborhood.empty())
+			buildLocalGrid(model, local_dimensions, cells);
 
 		std::unordered_map<int, std::vector<GridCellPack>> mpi_frontiers;
 
@@ -714,6 +809,7 @@ namespace fpmas { namespace model { namespace detail {
 		mpi_frontiers = mpi.allToAll(mpi_frontiers);
 
 		std::vector<CellType*> cell_frontiers;
+		std::vector<std::pair<DistributedId, DiscretePoint>> halo;
 		for(auto frontier : mpi_frontiers) {
 			for(auto cell_pack : frontier.second) {
 				// Builds a temporary cell
@@ -730,12 +826,44 @@ namespace fpmas { namespace model { namespace detail {
 				tmp_node->setLocation(frontier.first);
 				model.graph().insertDistant(tmp_node);
 				cell_frontiers.push_back(cell);
+				halo.push_back(cell_pack.first);
 			}
 		}
 
+		// Frontier links are built even in the IMPLICIT_TOPOLOGY mode, so
+		// that the DISTANT halo cells are not cleared from the graph
 		linkFrontiers(model, local_dimensions, cells, cell_frontiers);
 
 		model.graph().synchronize();
+
+		if(!implicit_neighborhood.empty()) {
+			DiscretePoint origin = local_dimensions.getOrigin();
+			DiscretePoint extent = local_dimensions.getExtent();
+			auto topology = std::make_shared<LocalGridTopology<CellType>>(
+					DiscretePoint(origin.x-1, origin.y-1),
+					DiscretePoint(extent.x+1, extent.y+1),
+					implicit_neighborhood
+					);
+			for(auto& row : cells)
+				for(auto cell : row)
+					topology->setCell(cell->location(), cell);
+			// Halo cells are retrieved from the graph, since temporary cells
+			// built above might have been replaced by already inserted cells
+			const auto& nodes = model.graph().getNodes();
+			for(auto& halo_cell : halo) {
+				auto node = nodes.find(halo_cell.first);
+				if(node != nodes.end())
+					topology->setCell(
+							halo_cell.second,
+							static_cast<CellType*>(node->second->data().get())
+							);
+			}
+			std::shared_ptr<const LocalGridTopology<CellType>> shared_topology
+				= topology;
+			for(auto& row : cells)
+				for(auto cell : row)
+					GridTopologySupport<CellType>::attach(cell, shared_topology);
+		}
 		std::vector<CellType*> built_cells;
 		for(auto row : cells)
 			for(auto cell : row)
@@ -0,0 +1,352 @@
+#ifndef FPMAS_GRID_MOVE_ALGO_H
+#define FPMAS_GRID_MOVE_ALGO_H
+
+/**\file src/fpmas/model/spatial/grid_move_algo.h
+ * Grid specialized distributed move algorithm implementation.
+ */
+
+#include "grid.h"
+#include "grid_load_balancing.h"
+#include "fpmas/graph/distributed_node.h"
+
+namespace fpmas { namespace model {
+
+	/**
+	 * api::model::DistributedMoveAlgorithm implementation specialized for
+	 * \GridCells.
+	 *
+	 * The regular DistributedMoveAlgorithm grows mobility and perception
+	 * fields step by step through the CELL_SUCCESSOR layer, what requires a
+	 * global link synchronization for each step, i.e. at least
+	 * `range.radius()` link synchronizations.
+	 *
+	 * Instead, this algorithm directly enumerates the DiscretePoints that
+	 * might be contained in the mobility and perception ranges of each moving
+	 * agent, i.e. all the points whose Chebyshev distance to the agent
+	 * location is less than or equal to the range radius. Points
+	 * corresponding to \GridCells that are not available on the current
+	 * process are mapped to their owner process using a GridProcessMapping,
+	 * and all the missing cells are fetched in a single exchange. Cells
+	 * contained in the ranges are then directly linked on the MOVE and
+	 * PERCEIVE layers, and perceptions are updated as usual by cells.
+	 *
+	 * The resulting MOVE, PERCEIVE and PERCEPTION links are the same as the
+	 * ones built by the DistributedMoveAlgorithm, provided that:
+	 * - the radius of the ranges is expressed with a distance greater than or
+	 *   equal to the Chebyshev distance, what is the case for MooreGrid and
+	 *   VonNeumannGrid configurations,
+	 * - the cells of the grid are distributed according to the specified
+	 *   GridProcessMapping, what is the case when the grid is built with a
+	 *   MooreGridBuilder or a VonNeumannGridBuilder and the
+	 *   TreeProcessMapping, or when the same GridProcessMapping is used by a
+	 *   GridLoadBalancing.
+	 *
+	 * Cells that are not found on their owner process are silently ignored.
+	 *
+	 * The algorithm can be used by a MoveAgentGroup instead of the default
+	 * DistributedMoveAlgorithm with
+	 * MoveAgentGroup::setDistributedMoveAlgorithm().
+	 *
+	 * @par Example
+	 * ```cpp
+	 * auto& move_group = grid_model.buildMoveGroup(MOVE_GROUP, move_behavior);
+	 * fpmas::model::GridMoveAlgorithm<UserCell> grid_move_algo(
+	 * 	grid_model, move_group, width, height
+	 * 	);
+	 * move_group.setDistributedMoveAlgorithm(grid_move_algo);
+	 * ```
+	 *
+	 * @tparam CellType type of \GridCells on which agents are moving
+	 */
+	template<typename CellType>
+		class GridMoveAlgorithm : public api::model::DistributedMoveAlgorithm<CellType> {
+			static_assert(std::is_base_of<api::model::GridCell, CellType>::value,
+					"The specified CellType must extend api::model::GridCell.");
+			private:
+				class AlgoTask : public scheduler::TaskBase<api::scheduler::Task> {
+					private:
+						GridMoveAlgorithm& grid_move_algo;
+
+					public:
+						AlgoTask(GridMoveAlgorithm& grid_move_algo)
+							: grid_move_algo(grid_move_algo) {}
+
+						/**
+						 * Runs the grid move algorithm
+						 */
+						void run() override;
+				};
+				typedef std::unordered_map<DiscretePoint, CellType*, PointHash>
+					CellIndex;
+
+				api::model::SpatialModel<CellType>& model;
+				api::model::AgentGroup& move_agent_group;
+				api::model::AgentGroup& cell_group;
+				std::unique_ptr<TreeProcessMapping> default_process_mapping;
+				const GridProcessMapping& grid_process_mapping;
+				DiscreteCoordinate width;
+				DiscreteCoordinate height;
+
+				AlgoTask algo_task;
+				scheduler::Job algo_job;
+
+				void fetchCells(
+						const std::vector<api::model::SpatialAgent<CellType>*>& agents,
+						CellIndex& cell_index);
+				void linkFields(
+						api::model::SpatialAgent<CellType>* agent,
+						const CellIndex& cell_index);
+
+			public:
+				/**
+				 * GridMoveAlgorithm constructor.
+				 *
+				 * @param model spatial model
+				 * @param move_agent_group group of moving agents
+				 * @param grid_process_mapping mapping of \GridCells to processes,
+				 * that must correspond to the current distribution of cells
+				 * @param width global grid width
+				 * @param height global grid height
+				 */
+				GridMoveAlgorithm(
+						api::model::SpatialModel<CellType>& model,
+						api::model::AgentGroup& move_agent_group,
+						const GridProcessMapping& grid_process_mapping,
+						DiscreteCoordinate width, DiscreteCoordinate height) :
+					model(model), move_agent_group(move_agent_group),
+					cell_group(model.cellGroup()),
+					grid_process_mapping(grid_process_mapping),
+					width(width), height(height), algo_task(*this) {
+						algo_job.add(algo_task);
+					}
+
+				/**
+				 * GridMoveAlgorithm constructor.
+				 *
+				 * A TreeProcessMapping is used to map \GridCells to
+				 * processes, consistently with the distribution of cells
+				 * performed by the MooreGridBuilder and the
+				 * VonNeumannGridBuilder.
+				 *
+				 * @param model spatial model
+				 * @param move_agent_group group of moving agents
+				 * @param width global grid width
+				 * @param height global grid height
+				 */
+				GridMoveAlgorithm(
+						api::model::SpatialModel<CellType>& model,
+						api::model::AgentGroup& move_agent_group,
+						DiscreteCoordinate width, DiscreteCoordinate height) :
+					model(model), move_agent_group(move_agent_group),
+					cell_group(model.cellGroup()),
+					default_process_mapping(new TreeProcessMapping(
+								width, height, model.getMpiCommunicator())),
+					grid_process_mapping(*default_process_mapping),
+					width(width), height(height), algo_task(*this) {
+						algo_job.add(algo_task);
+					}
+
+				/**
+				 * \copydoc api::model::DistributedMoveAlgorithm::jobs
+				 */
+				api::scheduler::JobList jobs() const override {
+					return {algo_job};
+				}
+		};
+
+	template<typename CellType>
+		void GridMoveAlgorithm<CellType>::fetchCells(
+				const std::vector<api::model::SpatialAgent<CellType>*>& agents,
+				CellIndex& cell_index) {
+			auto& graph = model.graph();
+			int rank = model.getMpiCommunicator().getRank();
+
+			std::unordered_map<int, std::set<DiscretePoint>> missing_points;
+			for(auto agent : agents) {
+				// No ReadGuard: the location of a GridCell never changes, and
+				// HardSyncMode read requests can't be served while other
+				// processes are blocked in the collective exchanges below.
+				auto location = agent->locationCell();
+				DiscretePoint point = location->location();
+				DiscreteCoordinate radius = std::max(
+						agent->mobilityRange().radius(location),
+						agent->perceptionRange().radius(location)
+						);
+				for(DiscreteCoordinate y = std::max(point.y - radius, 0l);
+						y <= std::min(point.y + radius, height-1); y++)
+					for(DiscreteCoordinate x = std::max(point.x - radius, 0l);
+							x <= std::min(point.x + radius, width-1); x++)
+						if(cell_index.count({x, y}) == 0) {
+							int process = grid_process_mapping.process({x, y});
+							if(process != rank)
+								missing_points[process].insert({x, y});
+						}
+			}
+
+			// Sends requested points to owner processes
+			std::unordered_map<int, std::vector<DiscretePoint>> requests;
+			for(auto& item : missing_points)
+				requests[item.first] = {item.second.begin(), item.second.end()};
+			communication::TypedMpi<std::vector<DiscretePoint>> point_mpi(
+					model.getMpiCommunicator());
+			requests = point_mpi.allToAll(requests);
+
+			// Sends back requested cells
+			std::unordered_map<int, std::vector<graph::NodePtrWrapper<AgentPtr>>> responses;
+			for(auto& item : requests) {
+				for(auto& point : item.second) {
+					auto cell = cell_index.find(point);
+					if(cell != cell_index.end()
+							&& cell->second->node()->state() == api::graph::LOCAL)
+						responses[item.first].emplace_back(cell->second->node());
+				}
+			}
+			communication::TypedMpi<std::vector<graph::NodePtrWrapper<AgentPtr>>>
+				node_mpi(model.getMpiCommunicator());
+			responses = node_mpi.allToAll(responses);
+
+			// Inserts fetched cells as DISTANT nodes
+			for(auto& item : responses) {
+				for(auto& node : item.second) {
+					node->setLocation(item.first);
+					auto* cell_node = graph.insertDistant(node);
+					auto* cell = static_cast<CellType*>(cell_node->data().get());
+					cell_index[cell->location()] = cell;
+				}
+			}
+		}
+
+	template<typename CellType>
+		void GridMoveAlgorithm<CellType>::linkFields(
+				api::model::SpatialAgent<CellType>* agent,
+				const CellIndex& cell_index) {
+			// See fetchCells() for the absence of ReadGuards
+			auto location = agent->locationCell();
+			DiscretePoint point = location->location();
+			std::size_t mobility_radius = agent->mobilityRange().radius(location);
+			std::size_t perception_radius = agent->perceptionRange().radius(location);
+			DiscreteCoordinate radius = std::max(mobility_radius, perception_radius);
+
+			detail::CurrentOutLayer move_layer(agent, SpatialModelLayers::MOVE);
+			detail::CurrentOutLayer perceive_layer(agent, SpatialModelLayers::PERCEIVE);
+			for(DiscreteCoordinate y = std::max(point.y - radius, 0l);
+					y <= std::min(point.y + radius, height-1); y++) {
+				for(DiscreteCoordinate x = std::max(point.x - radius, 0l);
+						x <= std::min(point.x + radius, width-1); x++) {
+					auto it = cell_index.find({x, y});
+					if(it == cell_index.end())
+						continue;
+					CellType* cell = it->second;
+					if(!move_layer.contains(cell)
+							&& agent->mobilityRange().contains(location, cell))
+						move_layer.link(cell);
+					if(!perceive_layer.contains(cell)
+							&& agent->perceptionRange().contains(location, cell))
+						perceive_layer.link(cell);
+				}
+			}
+		}
+
+	template<typename CellType>
+		void GridMoveAlgorithm<CellType>::AlgoTask::run() {
+			FPMAS_LOGD(this->grid_move_algo.model.getMpiCommunicator().getRank(),
+					"GRID_MA", "Running GridMoveAlgorithm...", "");
+			using api::model::SpatialAgent;
+			auto& model = grid_move_algo.model;
+
+			std::vector<SpatialAgent<CellType>*> agents;
+			for(auto agent : grid_move_algo.move_agent_group.localAgents()) {
+				// The algorithm is only applied to agents that updated their
+				// location since the last execution
+				if(agent->node()->getOutgoingEdges(
+							api::model::SpatialModelLayers::NEW_LOCATION).size() > 0)
+					agents.push_back(
+							static_cast<SpatialAgent<CellType>*>(agent));
+			}
+
+			// Obsolete perceptions of moving agents, see
+			// DistributedMoveAlgorithm
+			for(auto agent : agents) {
+				for(auto perceiver : agent->node()->getIncomingEdges(fpmas::api::model::PERCEPTION)) {
+					model.graph().unlink(perceiver);
+				}
+			}
+			// PERCEPTION edges of agents that query their perceptions are
+			// rebuilt at each execution, since they depend on the current
+			// distribution of cells
+			for(auto agent : grid_move_algo.move_agent_group.localAgents())
+				if(static_cast<SpatialAgent<CellType>*>(agent)->perceptionMode()
+						== api::model::QUERIED_PERCEPTIONS)
+					for(auto perception : agent->node()->getOutgoingEdges(
+								api::model::SpatialModelLayers::PERCEPTION))
+						model.graph().unlink(perception);
+			model.graph().synchronizationMode().getSyncLinker().synchronize();
+
+			std::vector<CellType*> cells;
+			for(auto cell : grid_move_algo.cell_group.localAgents()) {
+				cells.push_back(static_cast<CellType*>(cell));
+				// Required to initialize perception flags
+				cells.back()->init();
+				cells.back()->node()->mutex()->synchronize();
+			}
+
+			// Index of all the cells currently available on this process. The
+			// location of a GridCell never changes, so there is no need to
+			// read DISTANT cells.
+			CellIndex cell_index;
+			for(auto cell : grid_move_algo.cell_group.agents()) {
+				auto* grid_cell = static_cast<CellType*>(cell);
+				cell_index[grid_cell->location()] = grid_cell;
+			}
+
+			// Fetches all the missing cells in a single exchange
+			grid_move_algo.fetchCells(agents, cell_index);
+
+			// Replaces NEW_LOCATION links by LOCATION links. This is handled
+			// by the agent, instead of by the cell as in the
+			// DistributedMoveAlgorithm. DISTANT links and unlinks are only
+			// performed after the collective exchanges of fetchCells(), since
+			// HardSyncMode requests can't be served while other processes are
+			// blocked in those exchanges.
+			for(auto agent : agents) {
+				auto new_location_edge = agent->node()->getOutgoingEdges(
+						SpatialModelLayers::NEW_LOCATION)[0];
+				if(new_location_edge->state() == api::graph::LOCAL) {
+					model.graph().switchLayer(
+							new_location_edge, SpatialModelLayers::LOCATION
+							);
+				} else {
+					model.graph().link(
+							agent->node(), new_location_edge->getTargetNode(),
+							SpatialModelLayers::LOCATION
+							);
+					model.graph().unlink(new_location_edge);
+				}
+			}
+
+			for(auto agent : agents)
+				grid_move_algo.linkFields(agent, cell_index);
+
+			// Synchronizes LOCATION, MOVE and PERCEIVE links, so that
+			// perceptions can be updated by cells
+			model.graph().synchronizationMode().getSyncLinker().synchronize();
+			// Synchronizes newly imported cells
+			model.graph().synchronize(model.graph().getUnsyncNodes(), false);
+
+			for(auto cell : cells) {
+				// Update agent perceptions (creates
+				// PERCEPTION links)
+				cell->updatePerceptions(grid_move_algo.move_agent_group);
+			}
+			// Synchronizes perception links
+			model.graph().synchronizationMode().getSyncLinker().synchronize();
+
+			// Synchronizes data of DISTANT agents that might have been created
+			// when updating perceptions
+			model.graph().synchronize(model.graph().getUnsyncNodes(), false);
+
+			FPMAS_LOGD(model.getMpiCommunicator().getRank(),
+					"GRID_MA", "Done.", "");
+		}
+}}
+#endif
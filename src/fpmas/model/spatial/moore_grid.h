@@ -84,6 +84,20 @@ namespace fpmas { namespace model {
 					typename detail::GridBuilder<CellType>::CellMatrix& local_cells,
 					std::vector<CellType*>& frontier
 					) const override;
+
+			/**
+			 * Offsets of the Moore neighborhood, used to compute cell
+			 * successors in the IMPLICIT_TOPOLOGY mode.
+			 *
+			 * @return the 8 offsets of the Moore neighborhood
+			 */
+			std::vector<DiscretePoint> neighborhood() const override {
+				return {
+					{-1, -1}, {0, -1}, {1, -1},
+					{-1, 0}, {1, 0},
+					{-1, 1}, {0, 1}, {1, 1}
+				};
+			}
 		public:
 			using detail::GridBuilder<CellType>::GridBuilder;
 	};
@@ -7,8 +7,10 @@
 
 #include "dist_move_algo.h"
 #include "fpmas/api/model/exceptions.h"
+#include "fpmas/graph/id_flags.h"
 #include "../serializer.h"
 #include <type_traits>
+#include <unordered_set>
 
 
 /**
@@ -44,6 +46,22 @@
 #define FPMAS_PERCEPTION_RANGE(RANGE)\
 	const decltype(RANGE)& perceptionRange() const override {return RANGE;}
 
+/**
+ * Utility macro to define the
+ * fpmas::api::model::SpatialAgent::perceptionMode() method for the current
+ * agent so that it returns the specified MODE.
+ *
+ * This macro must be called within the class definition of a SpatialAgent.
+ *
+ * Using this macro is not required: the perceptionMode() method can be
+ * manually defined. By default, SpatialAgentBase uses
+ * fpmas::api::model::LINKED_PERCEPTIONS.
+ *
+ * @param MODE fpmas::api::model::PerceptionMode of the agent
+ */
+#define FPMAS_PERCEPTION_MODE(MODE)\
+	fpmas::api::model::PerceptionMode perceptionMode() const override {return MODE;}
+
 namespace fpmas { namespace model {
 	using api::model::SpatialModelLayers;
 	using api::model::DistributedId;
@@ -74,6 +92,8 @@ namespace fpmas { namespace model {
 				private:
 					api::model::SpatialModel<CellType>& model;
 					DistributedMoveAlgorithm<CellType> dist_move_algo;
+					api::model::DistributedMoveAlgorithm<CellType>* move_algo
+						= &dist_move_algo;
 
 				public:
 					/**
@@ -119,7 +139,23 @@ namespace fpmas { namespace model {
 					api::scheduler::JobList jobs() const override;
 
 					api::model::DistributedMoveAlgorithm<CellType>& distributedMoveAlgorithm()  override {
-						return dist_move_algo;
+						return *move_algo;
+					}
+
+					/**
+					 * Replaces the default DistributedMoveAlgorithm used to
+					 * commit moveTo() operations performed by agents of this
+					 * group.
+					 *
+					 * This can be used to specify a GridMoveAlgorithm on
+					 * grids. The specified algorithm must remain valid as long
+					 * as this group is used.
+					 *
+					 * @param move_algo distributed move algorithm
+					 */
+					void setDistributedMoveAlgorithm(
+							api::model::DistributedMoveAlgorithm<CellType>& move_algo) {
+						this->move_algo = &move_algo;
 					}
 			};
 
@@ -128,7 +164,7 @@ namespace fpmas { namespace model {
 			api::scheduler::JobList job_list;
 			job_list.push_back(this->agentExecutionJob());
 
-			for(auto job : dist_move_algo.jobs())
+			for(auto job : move_algo->jobs())
 				job_list.push_back(job);
 			return job_list;
 		}
@@ -229,6 +265,7 @@ namespace fpmas { namespace model {
 			 */
 			std::vector<CellType*> successors_buffer;
 			std::vector<api::model::AgentEdge*> raw_successors_buffer;
+			bool implicit_successors_buffered = false;
 			const std::vector<CellType*>& bufferedSuccessors();
 
 
@@ -240,13 +277,34 @@ namespace fpmas { namespace model {
 			void growPerceptionField(api::model::Agent* agent);
 
 		protected:
+			/**
+			 * Computes the successors of this cell without relying on
+			 * CELL_SUCCESSOR edges, if possible.
+			 *
+			 * If this method returns true, successors returned by
+			 * successors() and used by the DistributedMoveAlgorithm are the
+			 * ones appended to `successors`, and CELL_SUCCESSOR edges are
+			 * ignored. Successors computed this way are buffered by init()
+			 * only once, so they must not change during the simulation.
+			 *
+			 * The default implementation returns false, what means that
+			 * successors are always computed from CELL_SUCCESSOR edges.
+			 *
+			 * @param successors output successors list
+			 * @return true iff successors were computed
+			 */
+			virtual bool implicitSuccessors(std::vector<CellType*>& successors) {
+				(void) successors;
+				return false;
+			}
+
 			/**
 			 * A local set of ids of agents that have **not** moved since the
 			 * last DistributedMoveAlgorithm execution.
 			 *
 			 * **internal use only**
 			 */
-			std::set<DistributedId> no_move_flags;
+			graph::IdFlags no_move_flags;
 			/**
 			 * A local set of ids of agents that have explored the current cell
 			 * on the MOVE layer during the current DistributedMoveAlgorithm
@@ -254,7 +312,7 @@ namespace fpmas { namespace model {
 			 *
 			 * **internal use only**
 			 */
-			std::set<DistributedId> move_flags;
+			graph::IdFlags move_flags;
 			/**
 			 * A local set of ids of agents that have explored the current cell
 			 * on the PERCEIVE layer during the current DistributedMoveAlgorithm
@@ -262,7 +320,14 @@ namespace fpmas { namespace model {
 			 *
 			 * **internal use only**
 			 */
-			std::set<DistributedId> perception_flags;
+			graph::IdFlags perception_flags;
+			/**
+			 * A local set of ids of agents linked to the current cell on the
+			 * NEW_LOCATION layer, used by init().
+			 *
+			 * **internal use only**
+			 */
+			graph::IdFlags new_location_layer;
 
 		public:
 			/**
@@ -384,41 +449,54 @@ namespace fpmas { namespace model {
 
 	template<typename CellInterface, typename CellType, typename TypeIdBase>
 		void CellBase<CellInterface, CellType, TypeIdBase>::init() {
-			bool init_successors;
-
-			// This has no performance impact
-			auto current_successors
-				= this->node()->getOutgoingEdges(SpatialModelLayers::CELL_SUCCESSOR);
-			// Checks if the currently buffered successors are stricly equal to the
-			// current_successors. In this case, there is no need to update the
-			// successors() list
-			if(current_successors.size() == 0 ||
-					current_successors.size() != raw_successors_buffer.size()) {
-				init_successors = false;
-			} else {
-				auto it = current_successors.begin();
-				auto raw_it = raw_successors_buffer.begin();
-				while(it != current_successors.end() && (*it) == *raw_it) {
-					it++;
-					raw_it++;
+			if(!implicit_successors_buffered) {
+				std::vector<CellType*> implicit_successors;
+				if(this->implicitSuccessors(implicit_successors)) {
+					// Successors do not depend on CELL_SUCCESSOR edges, so
+					// they are buffered once for all
+					successors_buffer = std::move(implicit_successors);
+					raw_successors_buffer.clear();
+					implicit_successors_buffered = true;
 				}
-				if(it == current_successors.end()) {
-					init_successors = true;
-				} else {
+			}
+
+			if(!implicit_successors_buffered) {
+				bool init_successors;
+
+				// This has no performance impact
+				auto current_successors
+					= this->node()->getOutgoingEdges(SpatialModelLayers::CELL_SUCCESSOR);
+				// Checks if the currently buffered successors are stricly equal to the
+				// current_successors. In this case, there is no need to update the
+				// successors() list
+				if(current_successors.size() == 0 ||
+						current_successors.size() != raw_successors_buffer.size()) {
 					init_successors = false;
+				} else {
+					auto it = current_successors.begin();
+					auto raw_it = raw_successors_buffer.begin();
+					while(it != current_successors.end() && (*it) == *raw_it) {
+						it++;
+						raw_it++;
+					}
+					if(it == current_successors.end()) {
+						init_successors = true;
+					} else {
+						init_successors = false;
+					}
 				}
-			}
 
-			if(!init_successors) {
-				raw_successors_buffer = current_successors;
-				successors_buffer.resize(raw_successors_buffer.size());
-				for(std::size_t i = 0; i < raw_successors_buffer.size(); i++)
-					successors_buffer[i] = static_cast<CellType*>(
-							raw_successors_buffer[i]->getTargetNode()->data().get()
-							);
+				if(!init_successors) {
+					raw_successors_buffer = current_successors;
+					successors_buffer.resize(raw_successors_buffer.size());
+					for(std::size_t i = 0; i < raw_successors_buffer.size(); i++)
+						successors_buffer[i] = static_cast<CellType*>(
+								raw_successors_buffer[i]->getTargetNode()->data().get()
+								);
+				}
 			}
 
-			std::set<DistributedId> new_location_layer;
+			new_location_layer.clear();
 			for(auto agent_edge
 					: this->node()->getIncomingEdges(SpatialModelLayers::NEW_LOCATION))
 				new_location_layer.insert(agent_edge->getSourceNode()->getId());
@@ -493,6 +571,10 @@ namespace fpmas { namespace model {
 
 	template<typename CellInterface, typename CellType, typename TypeIdBase>
 		std::vector<api::model::Cell*> CellBase<CellInterface, CellType, TypeIdBase>::successors() {
+		std::vector<CellType*> implicit_successors;
+		if(this->implicitSuccessors(implicit_successors))
+			return {implicit_successors.begin(), implicit_successors.end()};
+
 		std::vector<api::model::Cell*> neighbors;
 		for(auto edge : this->node()->getOutgoingEdges(SpatialModelLayers::CELL_SUCCESSOR)) {
 			// Assumes that agents on the CELL_SUCCESSOR layer are necessarily
@@ -580,7 +662,7 @@ namespace fpmas { namespace model {
 	}
 
 	template<typename CellInterface, typename CellType, typename TypeIdBase>
-		void CellBase<CellInterface, CellType, TypeIdBase>::updatePerceptions(api::model::AgentGroup&) {
+		void CellBase<CellInterface, CellType, TypeIdBase>::updatePerceptions(api::model::AgentGroup& group) {
 		FPMAS_LOGD(this->model()->graph().getMpiCommunicator().getRank(), "[CELL]",
 				"%s Updating perceptions...",
 				FPMAS_C_STR(this->node()->getId()));
@@ -591,12 +673,28 @@ namespace fpmas { namespace model {
 			this->node()->getIncomingEdges(SpatialModelLayers::LOCATION);
 		for(auto agent_edge : this->node()->getIncomingEdges(SpatialModelLayers::PERCEIVE)) {
 			auto agent = agent_edge->getSourceNode();
+			bool rebuild_perceptions = false;
+			if(static_cast<api::model::SpatialAgent<CellType>*>(agent->data().get())
+					->perceptionMode() == api::model::QUERIED_PERCEPTIONS) {
+				// LOCAL perceivers directly query the LOCATION layer of this
+				// cell
+				if(agent->state() == api::graph::LOCAL)
+					continue;
+				// Outgoing PERCEPTION edges of perceivers handled by the
+				// current DistributedMoveAlgorithm are all unlinked, so they
+				// must be rebuilt even if nothing moved
+				auto gids = agent->data()->groupIds();
+				rebuild_perceptions = std::find(
+						gids.begin(), gids.end(), group.groupId()
+						) != gids.end();
+			}
 			for(auto perceived_agent_edge : perceived_agent_edges) {
 				auto perceived_agent = perceived_agent_edge->getSourceNode();
 				// Perceptions need to be updated only if either the perceivee
 				// or the perceiver location has been updated since the last
 				// DistributedMoveAlgorithm execution
 				if(
+						rebuild_perceptions ||
 						this->no_move_flags.count(agent->getId()) == 0 ||
 						this->no_move_flags.count(perceived_agent->getId()) == 0
 						)
@@ -758,6 +856,8 @@ namespace fpmas { namespace model {
 					api::utils::PtrWrapper<SpatialAgentBase<SpatialAgentInterface, AgentType, CellType, Derived>>>;
 				friend fpmas::io::datapack::Serializer<
 					api::utils::PtrWrapper<SpatialAgentBase<SpatialAgentInterface, AgentType, CellType, Derived>>>;
+				friend fpmas::io::datapack::GhostSerializer<
+					api::utils::PtrWrapper<SpatialAgentBase<SpatialAgentInterface, AgentType, CellType, Derived>>>;
 
 				public:
 				/**
@@ -845,9 +945,56 @@ namespace fpmas { namespace model {
 				 */
 				template<typename NeighborType = api::model::Agent>
 					Neighbors<NeighborType> perceptions() const {
+						if(this->perceptionMode() == api::model::QUERIED_PERCEPTIONS)
+							return queryPerceptions<NeighborType>();
 						return this->template outNeighbors<NeighborType>(SpatialModelLayers::PERCEPTION);
 					}
 
+				/**
+				 * Queries \Agents located in the perception field of this
+				 * agent.
+				 *
+				 * Agents linked on the LOCATION layer to \Cells of the
+				 * perception field are returned, completed by PERCEPTION
+				 * out neighbors built for \Cells that are not LOCAL. Each
+				 * agent is returned only once, and this agent is never
+				 * returned. The edge of each returned Neighbor is its
+				 * LOCATION or PERCEPTION edge.
+				 *
+				 * Contrary to PERCEPTION edges, that are only updated by
+				 * the DistributedMoveAlgorithm, the LOCATION layer is
+				 * queried as is: agents that moved since the last
+				 * DistributedMoveAlgorithm execution are not perceived
+				 * until the next one.
+				 *
+				 * This method is used by perceptions() when
+				 * perceptionMode() is api::model::QUERIED_PERCEPTIONS.
+				 *
+				 * @tparam NeighborType type of perceived agents to return
+				 * @return list of perceived \Agents of type `NeighborType`
+				 */
+				template<typename NeighborType = api::model::Agent>
+					Neighbors<NeighborType> queryPerceptions() const {
+						std::vector<Neighbor<NeighborType>> out;
+						std::unordered_set<DistributedId> perceived_ids;
+						auto add = [&out, &perceived_ids, this] (
+								api::model::AgentNode* node, api::model::AgentEdge* edge) {
+							if(node != this->node()
+									&& dynamic_cast<NeighborType*>(node->data().get())
+									&& perceived_ids.insert(node->getId()).second)
+								out.emplace_back(&node->data(), edge);
+						};
+						for(auto cell_edge
+								: this->node()->getOutgoingEdges(SpatialModelLayers::PERCEIVE))
+							for(auto location_edge : cell_edge->getTargetNode()
+									->getIncomingEdges(SpatialModelLayers::LOCATION))
+								add(location_edge->getSourceNode(), location_edge);
+						for(auto perception_edge
+								: this->node()->getOutgoingEdges(SpatialModelLayers::PERCEPTION))
+							add(perception_edge->getTargetNode(), perception_edge);
+						return out;
+					}
+
 				public:
 				/**
 				 * \copydoc fpmas::api::model::SpatialAgent::initLocation
@@ -856,6 +1003,16 @@ namespace fpmas { namespace model {
 					this->moveTo(cell);
 				}
 
+				/**
+				 * \copydoc fpmas::api::model::SpatialAgent::perceptionMode
+				 *
+				 * Returns api::model::LINKED_PERCEPTIONS by default. Can be
+				 * overridden using the FPMAS_PERCEPTION_MODE() macro.
+				 */
+				api::model::PerceptionMode perceptionMode() const override {
+					return api::model::LINKED_PERCEPTIONS;
+				}
+
 				/**
 				 * \copydoc fpmas::api::model::SpatialAgent::locationId
 				 */
@@ -1391,6 +1548,97 @@ namespace fpmas { namespace io { namespace datapack {
 				derived_ptr->location_id = pack.get<fpmas::api::graph::DistributedId>();
 				return derived_ptr.get();
 			}
+
+			/**
+			 * Unserializes a polymorphic SpatialAgentBase from the specified
+			 * ObjectPack directly into the existing SpatialAgentBase pointed
+			 * by `ptr`.
+			 *
+			 * The `Derived` part is updated using the AgentUpdate<ObjectPack,
+			 * Derived> helper, so that no temporary instance is allocated if
+			 * `Derived` supports in place updates. The buffered location cell
+			 * is reset if the location of the agent has changed.
+			 *
+			 * @param pack source ObjectPack
+			 * @param ptr pointer to the SpatialAgentBase to update
+			 */
+			static void update_datapack(const ObjectPack& pack, Ptr ptr) {
+				AgentUpdate<ObjectPack, Derived>::update(
+						pack, static_cast<Derived*>(ptr.get()));
+				fpmas::api::graph::DistributedId location_id
+					= pack.get<fpmas::api::graph::DistributedId>();
+				if(location_id != ptr->location_id) {
+					ptr->location_id = location_id;
+					ptr->location_cell_buffer = nullptr;
+				}
+			}
+		};
+
+	/**
+	 * Polymorphic SpatialAgentBase GhostSerializer specialization.
+	 *
+	 * | Serialization Scheme ||
+	 * |----------------------||
+	 * | `Derived` ghost serialization | SpatialAgentBase::locationId() |
+	 *
+	 * The `Derived` part is serialized using the
+	 * AgentGhostSerializer<Derived> helper, that falls back to the regular
+	 * Serializer<PtrWrapper<Derived>> if no ghost serialization rules are
+	 * defined for `Derived`.
+	 *
+	 * @tparam AgentType final fpmas::api::model::SpatialAgent type to serialize
+	 * @tparam CellType type of cells used by the spatial model
+	 * @tparam Derived next derived class in the polymorphic serialization
+	 * chain
+	 */
+	template<typename SpatialAgentInterface, typename AgentType, typename CellType, typename Derived>
+		struct GhostSerializer<PtrWrapper<fpmas::model::SpatialAgentBase<SpatialAgentInterface, AgentType, CellType, Derived>>> {
+			/**
+			 * Pointer wrapper to a polymorphic SpatialAgentBase.
+			 */
+			typedef PtrWrapper<fpmas::model::SpatialAgentBase<SpatialAgentInterface, AgentType, CellType, Derived>> Ptr;
+
+			/**
+			 * Returns the buffer size required to serialize the ghost part
+			 * of the polymorphic SpatialAgentBase pointed by `ptr` to `p`.
+			 */
+			static std::size_t size(const ObjectPack& p, const Ptr& ptr) {
+				return AgentGhostSerializer<Derived>::size(p, PtrWrapper<Derived>(
+							const_cast<Derived*>(static_cast<const Derived*>(ptr.get()))))
+					+ p.size<DistributedId>();
+			}
+
+			/**
+			 * Serializes the ghost part of the polymorphic SpatialAgentBase
+			 * into the specified ObjectPack.
+			 *
+			 * @param pack destination ObjectPack
+			 * @param ptr pointer to a polymorphic SpatialAgentBase to serialize
+			 */
+			static void to_datapack(ObjectPack& pack, const Ptr& ptr) {
+				AgentGhostSerializer<Derived>::to_datapack(pack, PtrWrapper<Derived>(
+							const_cast<Derived*>(static_cast<const Derived*>(ptr.get()))));
+				pack.put(ptr->locationId());
+			}
+
+			/**
+			 * Unserializes ghost data into the existing polymorphic
+			 * SpatialAgentBase pointed by `ptr`.
+			 *
+			 * @param pack source ObjectPack
+			 * @param ptr pointer to the SpatialAgentBase to update
+			 */
+			static void update_datapack(const ObjectPack& pack, Ptr ptr) {
+				AgentGhostSerializer<Derived>::update_datapack(pack, PtrWrapper<Derived>(
+							static_cast<Derived*>(ptr.get())));
+				fpmas::api::graph::DistributedId location_id
+					= pack.get<fpmas::api::graph::DistributedId>();
+				if(location_id != ptr->location_id) {
+					// The buffered cell might not be available anymore
+					ptr->location_id = location_id;
+					ptr->location_cell_buffer = nullptr;
+				}
+			}
 		};
 
 	/**
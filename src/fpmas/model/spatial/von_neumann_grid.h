@@ -86,6 +86,18 @@ namespace fpmas { namespace model {
 					typename detail::GridBuilder<CellType>::CellMatrix& local_cells,
 					std::vector<CellType*>& frontier
 					) const override;
+
+			/**
+			 * Offsets of the VonNeumann neighborhood, used to compute cell
+			 * successors in the IMPLICIT_TOPOLOGY mode.
+			 *
+			 * @return the 4 offsets of the VonNeumann neighborhood
+			 */
+			std::vector<DiscretePoint> neighborhood() const override {
+				return {
+					{0, -1}, {-1, 0}, {1, 0}, {0, 1}
+				};
+			}
 		public:
 			using detail::GridBuilder<CellType>::GridBuilder;
 	};
@@ -40,21 +40,24 @@ namespace fpmas { namespace synchro {
 		 *
 		 * Data of each \DISTANT node is fetched from host processes at each
 		 * graph synchronization operation.
+		 *
+		 * Updates are sent as ObjectPacks with the same format as a
+		 * serialized `std::vector<NodeUpdatePack<T>>`, except that node data
+		 * is serialized using the io::datapack::GhostSerializer profile.
+		 * Received data is directly unserialized into local nodes using
+		 * synchro::DataUpdate<T>::update(T&, const io::datapack::ObjectPack&),
+		 * so that no temporary T instance is required when the DataUpdate
+		 * specialization supports it.
 		 */
 		template<typename T>
 			class GhostDataSync : public api::synchro::DataSync<T> {
 				public:
-					/**
-					 * TypedMpi used to transmit NodeUpdatePacks with MPI.
-					 */
-					typedef api::communication::TypedMpi<NodeUpdatePack<T>> DataMpi;
 					/**
 					 * TypedMpi used to transmit DistributedIds with MPI.
 					 */
 					typedef api::communication::TypedMpi<DistributedId> IdMpi;
 
 				private:
-					DataMpi& data_mpi;
 					IdMpi& id_mpi;
 
 					api::graph::DistributedGraph<T>& graph;
@@ -70,16 +73,15 @@ namespace fpmas { namespace synchro {
 					/**
 					 * GhostDataSync constructor.
 					 *
-					 * @param data_mpi DataMpi instance
 					 * @param id_mpi IdMpi instance
 					 * @param graph reference to the associated
 					 * DistributedGraph
 					 */
 					GhostDataSync(
-							DataMpi& data_mpi, IdMpi& id_mpi,
+							IdMpi& id_mpi,
 							api::graph::DistributedGraph<T>& graph
 							)
-						: data_mpi(data_mpi), id_mpi(id_mpi), graph(graph) {}
+						: id_mpi(id_mpi), graph(graph) {}
 
 					/**
 					 * Fetches updated data for all the \DISTANT nodes of the
@@ -101,32 +103,41 @@ namespace fpmas { namespace synchro {
 						);
 				requests = id_mpi.migrate(std::move(requests));
 
-				std::unordered_map<int, std::vector<NodeUpdatePack<T>>> updated_data;
-				updated_data.reserve(graph.getMpiCommunicator().getSize());
-				for(auto list : requests) {
-					updated_data[list.first].reserve(list.second.size());
+				// Serializes requested nodes with the
+				// std::vector<NodeUpdatePack<T>> format, without copying data
+				// into temporary NodeUpdatePacks. Only the ghost part of the
+				// data is serialized.
+				std::unordered_map<int, api::communication::DataPack> serial_data;
+				serial_data.reserve(requests.size());
+				for(auto& list : requests) {
+					io::datapack::ObjectPack pack;
+					pack.reserve(io::datapack::ObjectPack::DEFAULT_CAPACITY);
+					pack.put(list.second.size());
 					for(auto id : list.second) {
 						FPMAS_LOGV(
 								graph.getMpiCommunicator().getRank(), "GHOST_MODE",
 								"Export %s to %i", FPMAS_C_STR(id), list.first
 								);
 						auto node = graph.getNode(id);
-						updated_data[list.first].emplace_back(
-								id, node->data(), node->getWeight()
-								);
+						pack.put(id);
+						io::datapack::GhostSerializer<T>::to_datapack(
+								pack, node->data());
+						pack.put(node->getWeight());
 					}
+					serial_data.emplace(list.first, pack.dump());
 				}
 
-				// TODO : Should use data update packs.
-				updated_data = data_mpi.migrate(std::move(updated_data));
-				for(auto list : updated_data) {
-					for(auto& data : list.second) {
-						auto local_node = graph.getNode(data.id);
-						synchro::DataUpdate<T>::update(
-								local_node->data(),
-								std::move(data.updated_data)
-								);
-						local_node->setWeight(data.updated_weight);
+				for(auto& item : graph.getMpiCommunicator().allToAll(
+							std::move(serial_data), MPI_CHAR)) {
+					io::datapack::ObjectPack pack
+						= io::datapack::ObjectPack::parse(std::move(item.second));
+					std::size_t count = pack.get<std::size_t>();
+					for(std::size_t i = 0; i < count; i++) {
+						auto local_node = graph.getNode(pack.get<DistributedId>());
+						// Updated data is unserialized directly into the local
+						// node's data
+						synchro::DataUpdate<T>::update(local_node->data(), pack);
+						local_node->setWeight(pack.get<float>());
 					}
 				}
 
@@ -449,7 +460,6 @@ namespace fpmas { namespace synchro {
 		template<typename T, template<typename> class Mutex>
 			class GhostMode : public api::synchro::SyncMode<T> {
 				communication::TypedMpi<DistributedId> id_mpi;
-				communication::TypedMpi<NodeUpdatePack<T>> data_mpi;
 				communication::TypedMpi<api::utils::PtrWrapper<api::graph::DistributedEdge<T>>> edge_mpi;
 
 				GhostDataSync<T> data_sync;
@@ -465,8 +475,8 @@ namespace fpmas { namespace synchro {
 				GhostMode(
 						api::graph::DistributedGraph<T>& graph,
 						api::communication::MpiCommunicator& comm)
-					: id_mpi(comm), data_mpi(comm), edge_mpi(comm),
-					data_sync(data_mpi, id_mpi, graph), sync_linker(edge_mpi, id_mpi, graph) {}
+					: id_mpi(comm), edge_mpi(comm),
+					data_sync(id_mpi, graph), sync_linker(edge_mpi, id_mpi, graph) {}
 
 				/**
 				 * Builds a new SingleThreadMutex from the specified node data.
@@ -2,6 +2,7 @@
 #define FPMAS_SYNCHRO_H
 
 #include <utility>
+#include "fpmas/io/datapack.h"
 
 /** \file src/fpmas/synchro/synchro.h
  * Generic synchronisation utilities.
@@ -35,6 +36,24 @@ namespace fpmas { namespace synchro {
 			static void update(T& local_data, T&& updated_data) {
 				local_data = std::move(updated_data);
 			}
+
+			/**
+			 * Updates `local_data` from an updated T instance serialized in
+			 * `pack` with the io::datapack::GhostSerializer profile.
+			 *
+			 * By default, a temporary T instance is unserialized from `pack`
+			 * using io::datapack::GhostSerializer<T>::from_datapack() and
+			 * pulled into `local_data` using update(T&, T&&), but
+			 * specializations might unserialize data directly into
+			 * `local_data`.
+			 *
+			 * @param local_data reference to the local data to update
+			 * @param pack source ObjectPack, from which the updated data is
+			 * read at the current read offset
+			 */
+			static void update(T& local_data, const io::datapack::ObjectPack& pack) {
+				update(local_data, io::datapack::GhostSerializer<T>::from_datapack(pack));
+			}
 		};
 }}
 #endif
@@ -0,0 +1,56 @@
+#include "fpmas/graph/id_flags.h"
+
+#include "gmock/gmock.h"
+
+using fpmas::graph::IdFlags;
+using fpmas::api::graph::DistributedId;
+
+TEST(IdFlags, insert) {
+	IdFlags flags;
+	ASSERT_TRUE(flags.empty());
+	ASSERT_FALSE(flags.contains({0, 2}));
+
+	ASSERT_TRUE(flags.insert({0, 2}));
+	ASSERT_TRUE(flags.insert({3, 2}));
+	ASSERT_FALSE(flags.insert({0, 2}));
+
+	ASSERT_EQ(flags.size(), 2);
+	ASSERT_TRUE(flags.contains({0, 2}));
+	ASSERT_EQ(flags.count({3, 2}), 1);
+	ASSERT_FALSE(flags.contains({2, 0}));
+	ASSERT_EQ(flags.count({2, 3}), 0);
+}
+
+TEST(IdFlags, grow) {
+	IdFlags flags;
+	for(int rank = 0; rank < 4; rank++)
+		for(FPMAS_ID_TYPE id = 0; id < 500; id++)
+			ASSERT_TRUE(flags.insert({rank, id}));
+
+	ASSERT_EQ(flags.size(), 2000);
+	for(int rank = 0; rank < 4; rank++)
+		for(FPMAS_ID_TYPE id = 0; id < 500; id++)
+			ASSERT_TRUE(flags.contains({rank, id}));
+	ASSERT_FALSE(flags.contains({4, 0}));
+	ASSERT_FALSE(flags.contains({0, 500}));
+}
+
+TEST(IdFlags, clear) {
+	IdFlags flags;
+	for(FPMAS_ID_TYPE id = 0; id < 100; id++)
+		flags.insert({0, id});
+
+	for(int i = 0; i < 5; i++) {
+		flags.clear();
+		ASSERT_TRUE(flags.empty());
+		for(FPMAS_ID_TYPE id = 0; id < 100; id++)
+			ASSERT_FALSE(flags.contains({0, id}));
+
+		// Ids of the previous epochs are never considered
+		for(FPMAS_ID_TYPE id = i; id < 100; id+=5)
+			ASSERT_TRUE(flags.insert({0, id}));
+		ASSERT_EQ(flags.size(), 20);
+		for(FPMAS_ID_TYPE id = 0; id < 100; id++)
+			ASSERT_EQ(flags.contains({0, id}), id % 5 == (FPMAS_ID_TYPE) i);
+	}
+}
@@ -291,6 +291,54 @@ TEST_F(BasicObjectPackTest, assignment) {
 	ASSERT_EQ(pack.data().size, 12);
 }
 
+TEST_F(BasicObjectPackTest, growable_constructor) {
+	int i = 132;
+	EXPECT_CALL(*MockSerializer<int>::mock, size).Times(0);
+	EXPECT_CALL(*MockSerializer<int>::mock, to_datapack(_, i))
+		.WillOnce(Invoke([] (MockObjectPack& p, const int&) {
+					p.write((std::uint64_t) 0x0123456789ABCDEF);
+					p.write('a');
+					}));
+
+	MockObjectPack pack(i, GROWABLE);
+	ASSERT_EQ(pack.allocationMode(), GROWABLE);
+	// The buffer is shrunk to the written data
+	ASSERT_EQ(pack.data().size, sizeof(std::uint64_t) + sizeof(char));
+
+	std::uint64_t u_i;
+	char a;
+	pack.read(u_i);
+	pack.read(a);
+	ASSERT_EQ(u_i, (std::uint64_t) 0x0123456789ABCDEF);
+	ASSERT_EQ(a, 'a');
+}
+
+TEST_F(BasicObjectPackTest, growable_write) {
+	MockObjectPack pack;
+	pack.reserve(2);
+	for(std::uint32_t i = 0; i < 100; i++)
+		pack.write(i);
+	ASSERT_GE(pack.data().size, 100*sizeof(std::uint32_t));
+
+	pack.shrink();
+	ASSERT_EQ(pack.data().size, 100*sizeof(std::uint32_t));
+	for(std::uint32_t i = 0; i < 100; i++) {
+		std::uint32_t j;
+		pack.read(j);
+		ASSERT_EQ(j, i);
+	}
+}
+
+TEST_F(BasicObjectPackTest, growable_dump) {
+	MockObjectPack pack;
+	pack.reserve(64);
+	pack.write('a');
+	pack.write((std::int16_t) 0x1234);
+
+	DataPack dump = pack.dump();
+	ASSERT_EQ(dump.size, sizeof(char) + sizeof(std::int16_t));
+}
+
 TEST_F(BasicObjectPackTest, put) {
 	int i = 132;
 	MockObjectPack* to_datapack_arg;
@@ -405,6 +453,18 @@ TEST(ObjectPack, deque_distributed_id) {
 			);
 };
 
+// DistributedId containers share the same encoding, without padding bytes
+TEST(ObjectPack, distributed_id_containers_size) {
+	std::vector<DistributedId> vec {{0, 4}, {7, 2}, {3, 12}};
+	std::set<DistributedId> set(vec.begin(), vec.end());
+	ObjectPack pack;
+
+	ASSERT_EQ(pack.size(vec), pack.size(set));
+	ASSERT_EQ(
+			pack.size(vec),
+			pack.size<std::size_t>() + vec.size() * pack.size<DistributedId>());
+}
+
 TEST(ObjectPack, pair) {
 	typedef std::pair<float, std::string> TestPair;
 	TEST_DATAPACK_IO(
@@ -432,6 +492,75 @@ TEST(ObjectPack, array) {
 			);
 }
 
+TEST(ObjectPack, bulk_array) {
+	typedef std::array<double, 3> TestArray;
+	TEST_DATAPACK_IO(
+			TestArray,
+			{{1.2, -3.4, 5.6}},
+			{{0., 7e12, -2e-4}}
+			);
+}
+
+TEST(ObjectPack, bool_vector) {
+	TEST_DATAPACK_IO(
+			std::vector<bool>,
+			{true, false, true},
+			{false, false}
+			);
+}
+
+TEST(ObjectPack, bulk_vector) {
+	std::vector<float> vec {1.f, -2.5f, 14.f, 0.1f};
+	ObjectPack pack;
+	pack.allocate(pack.size(vec));
+	pack.put(vec);
+
+	ASSERT_EQ(pack.data().size, sizeof(std::size_t) + 4*sizeof(float));
+	ASSERT_EQ(
+			std::memcmp(
+				&pack.data().buffer[sizeof(std::size_t)], vec.data(),
+				4*sizeof(float)),
+			0);
+}
+
+namespace {
+	// No padding bytes
+	struct PodState {
+		double x;
+		std::int64_t count;
+	};
+
+	bool operator==(const PodState& s1, const PodState& s2) {
+		return s1.x == s2.x && s1.count == s2.count;
+	}
+}
+
+namespace fpmas { namespace io { namespace datapack {
+	template<>
+		struct is_trivially_serializable<PodState> : public std::true_type {
+		};
+}}}
+
+TEST(ObjectPack, trivially_serializable) {
+	TEST_DATAPACK_IO(PodState, {2.5, 4}, {-1., 12});
+}
+
+TEST(ObjectPack, trivially_serializable_vector) {
+	TEST_DATAPACK_IO(
+			std::vector<PodState>,
+			{{2.5, 4}, {0.1, -2}, {8.2, 12}},
+			{{-1., 12}}
+			);
+}
+
+TEST(ObjectPack, trivially_serializable_deque) {
+	TEST_DATAPACK_IO(
+			std::deque<PodState>,
+			{{2.5, 4}, {0.1, -2}, {8.2, 12}},
+			{{-1., 12}}
+			);
+}
+
 TEST(ObjectPack, empty_vec) {
 	std::vector<int> vec;
 	ObjectPack pack;
@@ -483,6 +612,30 @@ TEST(ObjectPack, expanded_objectpack) {
 	ASSERT_EQ(o1.get<std::uint64_t>(), (std::uint64_t) 0xFEDCBA9876543210);
 }
 
+TEST(ObjectPack, growable) {
+	std::vector<std::pair<std::string, std::set<DistributedId>>> data {
+		{"hello", {{0, 4}, {7, 2}}},
+		{"world", {}},
+		{"", {{3, 12}}}
+	};
+	ObjectPack exact_pack(data, EXACT);
+	ObjectPack growable_pack(data, GROWABLE);
+
+	ASSERT_EQ(growable_pack.data(), exact_pack.data());
+	ASSERT_EQ(growable_pack.get<decltype(data)>(), data);
+}
+
+TEST(ObjectPack, growable_objectpack) {
+	ObjectPack o1;
+	o1.reserve(4);
+	o1.put(std::string("hello world"));
+
+	// o1 is not shrunk: only written data is serialized
+	ObjectPack objectpack(o1, GROWABLE);
+	o1.shrink();
+	ASSERT_EQ(objectpack.get<ObjectPack>().data(), o1.data());
+}
+
 TEST(ObjectPack, str) {
 	std::string data = "hello world";
 	ObjectPack serial_data(data);
@@ -0,0 +1,293 @@
+#include "fpmas/model/spatial/continuous.h"
+#include "../../../mocks/synchro/mock_mutex.h"
+#include "../../../mocks/model/mock_grid.h"
+#include "test_agents.h"
+
+using namespace testing;
+using namespace fpmas::model;
+
+TEST(ContinuousSpace, bins) {
+	ContinuousSpace space(10, 7, 2);
+
+	ASSERT_EQ(space.binWidth(), 5);
+	ASSERT_EQ(space.binHeight(), 4);
+
+	ASSERT_TRUE(space.contains({0, 0}));
+	ASSERT_TRUE(space.contains({9.9, 6.9}));
+	ASSERT_FALSE(space.contains({10, 3}));
+	ASSERT_FALSE(space.contains({3, -0.1}));
+
+	ASSERT_EQ(space.bin({0, 0}), DiscretePoint(0, 0));
+	ASSERT_EQ(space.bin({1.9, 2}), DiscretePoint(0, 1));
+	ASSERT_EQ(space.bin({9.9, 6.9}), DiscretePoint(4, 3));
+
+	ASSERT_EQ(space.binCenter({2, 1}), ContinuousPoint(5, 3));
+}
+
+TEST(ContinuousSpace, bin_distance) {
+	ContinuousSpace space(20, 20, 2);
+
+	// Same and adjacent bins
+	ASSERT_EQ(space.binDistance({3, 3}, {3, 3}), 0);
+	ASSERT_EQ(space.binDistance({3, 3}, {4, 2}), 0);
+	// One bin between
+	ASSERT_EQ(space.binDistance({3, 3}, {5, 3}), 2);
+	ASSERT_EQ(space.binDistance({3, 3}, {3, 1}), 2);
+	ASSERT_FLOAT_EQ(space.binDistance({3, 3}, {5, 5}), std::sqrt(8));
+	ASSERT_FLOAT_EQ(space.binDistance({3, 3}, {0, 5}), std::sqrt(20));
+}
+
+TEST(ContinuousSpace, bin_radius) {
+	ContinuousSpace space(20, 20, 2);
+
+	ASSERT_EQ(space.binRadius(-1), 0);
+	ASSERT_EQ(space.binRadius(0), 1);
+	ASSERT_EQ(space.binRadius(1.5), 1);
+	ASSERT_EQ(space.binRadius(2), 2);
+	ASSERT_EQ(space.binRadius(5), 3);
+}
+
+TEST(ContinuousRange, range) {
+	ContinuousSpace space(20, 20, 2);
+	ContinuousRange<MockGridCell> range(space, 2.5);
+
+	NiceMock<MockGridCell> origin;
+	ON_CALL(origin, location).WillByDefault(Return(DiscretePoint(5, 5)));
+
+	ASSERT_EQ(range.radius(&origin), 2);
+
+	// Checks the range against a brute force computation on the points of
+	// the space
+	for(DiscreteCoordinate x = 0; x < 10; x++) {
+		for(DiscreteCoordinate y = 0; y < 10; y++) {
+			NiceMock<MockGridCell> cell;
+			ON_CALL(cell, location).WillByDefault(Return(DiscretePoint(x, y)));
+
+			bool expected = false;
+			for(double ox = 10; ox <= 12; ox+=.25)
+				for(double oy = 10; oy <= 12; oy+=.25)
+					for(double cx = 2*x; cx <= 2*x+2; cx+=.25)
+						for(double cy = 2*y; cy <= 2*y+2; cy+=.25)
+							if(fpmas::api::model::euclidian_distance(
+										ContinuousPoint(ox, oy), ContinuousPoint(cx, cy)) <= 2.5)
+								expected = true;
+			ASSERT_EQ(range.contains(&origin, &cell), expected)
+				<< DiscretePoint(x, y);
+			if(expected)
+				// The range is contained in the Moore radius
+				ASSERT_LE(ChebyshevDistance()({5, 5}, {x, y}), range.radius(&origin));
+		}
+	}
+
+	range.setRadius(-1);
+	ASSERT_EQ(range.radius(&origin), 0);
+	ASSERT_FALSE(range.contains(&origin, &origin));
+}
+
+TEST(ContinuousPoint, object_pack) {
+	std::vector<ContinuousPoint> points {{1.5, -2}, {0, 3.14}};
+	fpmas::io::datapack::ObjectPack pack = points;
+
+	ASSERT_EQ(pack.get<std::vector<ContinuousPoint>>(), points);
+}
+
+TEST(ContinuousPoint, json) {
+	nlohmann::json j = ContinuousPoint(1.5, -2);
+
+	ASSERT_EQ(j.get<ContinuousPoint>(), ContinuousPoint(1.5, -2));
+}
+
+/*
+ * Inheriting from ContinuousAgent is an hacky trick to get access to protected
+ * members (such as moveTo())
+ */
+class ContinuousAgentTest : public Test, protected model::test::ContinuousAgent {
+	protected:
+		typedef model::test::ContinuousAgent TestAgent;
+		TestAgent& agent {*this};
+		MockAgentNode<NiceMock> mock_agent_node {{0, 0}};
+		NiceMock<MockModel> mock_model;
+
+		NiceMock<MockGridCell> mock_cell;
+		fpmas::graph::DistributedId mock_cell_id {37, 2};
+		MockAgentNode<NiceMock> mock_cell_node {mock_cell_id, &mock_cell};
+		NiceMock<MockMutex<AgentPtr>> mock_cell_mutex;
+		DiscretePoint location_point {1, 2};
+
+		NiceMock<MockGridCell> mock_other_cell;
+		MockAgentNode<NiceMock> mock_other_cell_node {{37, 3}, &mock_other_cell};
+		NiceMock<MockMutex<AgentPtr>> mock_other_cell_mutex;
+		DiscretePoint other_location_point {2, 2};
+
+		static void SetUpTestSuite() {
+			TestAgent::mobility_range = new NiceMock<MockRange<MockGridCell>>;
+			TestAgent::perception_range = new NiceMock<MockRange<MockGridCell>>;
+		}
+		static void TearDownTestSuite() {
+			delete TestAgent::mobility_range;
+			delete TestAgent::perception_range;
+		}
+
+		void SetUp() override {
+			agent.setModel(&mock_model);
+			agent.setNode(&mock_agent_node);
+
+			ON_CALL(mock_cell, location)
+				.WillByDefault(Return(location_point));
+			ON_CALL(mock_cell, node())
+				.WillByDefault(Return(&mock_cell_node));
+			ON_CALL(Const(mock_cell), node())
+				.WillByDefault(Return(&mock_cell_node));
+			ON_CALL(mock_cell_node, mutex())
+				.WillByDefault(Return(&mock_cell_mutex));
+			ON_CALL(Const(mock_cell_node), mutex())
+				.WillByDefault(Return(&mock_cell_mutex));
+			ON_CALL(mock_cell_mutex, read)
+				.WillByDefault(ReturnRef(mock_cell_node.data()));
+
+			ON_CALL(mock_other_cell, location)
+				.WillByDefault(Return(other_location_point));
+			ON_CALL(mock_other_cell, node())
+				.WillByDefault(Return(&mock_other_cell_node));
+			ON_CALL(Const(mock_other_cell), node())
+				.WillByDefault(Return(&mock_other_cell_node));
+			ON_CALL(mock_other_cell_node, mutex())
+				.WillByDefault(Return(&mock_other_cell_mutex));
+			ON_CALL(Const(mock_other_cell_node), mutex())
+				.WillByDefault(Return(&mock_other_cell_mutex));
+			ON_CALL(mock_other_cell_mutex, read)
+				.WillByDefault(ReturnRef(mock_other_cell_node.data()));
+		}
+
+		void TearDown() override {
+			mock_cell_node.data().release();
+			mock_other_cell_node.data().release();
+		}
+
+		template<typename PackType>
+			void Serialize(PackType& pack) {
+				pack = fpmas::api::utils::PtrWrapper<TestAgent::JsonBase>(&agent);
+			}
+
+		template<typename PackType>
+			TestAgent* Unserialize(const PackType& pack) {
+				return static_cast<TestAgent*>(pack
+					.template get<fpmas::api::utils::PtrWrapper<TestAgent::JsonBase>>()
+					.get());
+			}
+};
+
+TEST_F(ContinuousAgentTest, init_location) {
+	agent.initLocation(&mock_cell, {3.5, 4.2});
+
+	ASSERT_EQ(agent.locationPoint(), location_point);
+	ASSERT_EQ(agent.position(), ContinuousPoint(3.5, 4.2));
+}
+
+TEST_F(ContinuousAgentTest, init_location_cell) {
+	agent.initLocation(&mock_cell);
+
+	ASSERT_EQ(agent.locationPoint(), location_point);
+	// Center of the bin
+	ASSERT_EQ(agent.position(), ContinuousPoint(3, 5));
+}
+
+TEST_F(ContinuousAgentTest, move_within_bin) {
+	agent.initLocation(&mock_cell, {3.5, 4.2});
+
+	EXPECT_CALL(mock_model, link).Times(0);
+	EXPECT_CALL(mock_model, unlink).Times(0);
+
+	this->moveTo(ContinuousPoint(2.1, 5.9));
+
+	ASSERT_EQ(agent.locationPoint(), location_point);
+	ASSERT_EQ(agent.position(), ContinuousPoint(2.1, 5.9));
+}
+
+TEST_F(ContinuousAgentTest, move_to_other_bin) {
+	agent.initLocation(&mock_cell, {3.5, 4.2});
+
+	// Build MOVE layer
+	std::vector<AgentNode*> move_neighbors {&mock_cell_node, &mock_other_cell_node};
+	MockAgentEdge<NiceMock> mock_cell_edge;
+	mock_cell_edge.setSourceNode(&mock_agent_node);
+	mock_cell_edge.setTargetNode(&mock_cell_node);
+	MockAgentEdge<NiceMock> mock_other_cell_edge;
+	mock_other_cell_edge.setSourceNode(&mock_agent_node);
+	mock_other_cell_edge.setTargetNode(&mock_other_cell_node);
+	std::vector<AgentEdge*> move_neighbor_edges {
+		&mock_cell_edge, &mock_other_cell_edge};
+
+	ON_CALL(mock_agent_node, outNeighbors(SpatialModelLayers::MOVE))
+		.WillByDefault(Return(move_neighbors));
+	ON_CALL(mock_agent_node, getOutgoingEdges(SpatialModelLayers::MOVE))
+		.WillByDefault(Return(move_neighbor_edges));
+
+	EXPECT_CALL(mock_model, link(this, &mock_other_cell, SpatialModelLayers::NEW_LOCATION));
+
+	this->moveTo(ContinuousPoint(4.5, 4.2));
+
+	ASSERT_EQ(agent.locationPoint(), other_location_point);
+	ASSERT_EQ(agent.position(), ContinuousPoint(4.5, 4.2));
+}
+
+TEST_F(ContinuousAgentTest, move_out_of_field) {
+	agent.initLocation(&mock_cell, {3.5, 4.2});
+
+	ASSERT_THROW(
+			this->moveTo(ContinuousPoint(4.5, 4.2)),
+			fpmas::api::model::OutOfMobilityFieldException
+			);
+	ASSERT_EQ(agent.position(), ContinuousPoint(3.5, 4.2));
+}
+
+TEST_F(ContinuousAgentTest, json) {
+	agent.initLocation(&mock_cell, {3.5, 4.2});
+	nlohmann::json j;
+	Serialize(j);
+
+	auto unserialized_agent = Unserialize(j);
+
+	ASSERT_EQ(unserialized_agent->locationId(), mock_cell_id);
+	ASSERT_EQ(unserialized_agent->locationPoint(), location_point);
+	ASSERT_EQ(unserialized_agent->position(), agent.position());
+
+	delete unserialized_agent;
+}
+
+TEST_F(ContinuousAgentTest, object_pack) {
+	agent.initLocation(&mock_cell, {3.5, 4.2});
+	fpmas::io::datapack::ObjectPack pack;
+	Serialize(pack);
+
+	auto unserialized_agent = Unserialize(pack);
+
+	ASSERT_EQ(unserialized_agent->locationId(), mock_cell_id);
+	ASSERT_EQ(unserialized_agent->locationPoint(), location_point);
+	ASSERT_EQ(unserialized_agent->position(), agent.position());
+
+	delete unserialized_agent;
+}
+
+TEST_F(ContinuousAgentTest, ghost_object_pack) {
+	typedef fpmas::io::datapack::GhostSerializer<
+		fpmas::api::utils::PtrWrapper<TestAgent::JsonBase>> GhostSerializer;
+	agent.initLocation(&mock_cell, {3.5, 4.2});
+	fpmas::api::utils::PtrWrapper<TestAgent::JsonBase> src(&agent);
+	fpmas::io::datapack::ObjectPack ghost_pack;
+	ghost_pack.allocate(GhostSerializer::size(ghost_pack, src));
+	GhostSerializer::to_datapack(ghost_pack, src);
+
+	fpmas::io::datapack::LightObjectPack light_pack;
+	Serialize(light_pack);
+	fpmas::api::utils::PtrWrapper<TestAgent::JsonBase> ghost_agent
+		= Unserialize(light_pack);
+	GhostSerializer::update_datapack(ghost_pack, ghost_agent);
+
+	auto* updated_agent = static_cast<TestAgent*>(ghost_agent.get());
+	ASSERT_EQ(updated_agent->locationId(), mock_cell_id);
+	ASSERT_EQ(updated_agent->locationPoint(), location_point);
+	ASSERT_EQ(updated_agent->position(), agent.position());
+
+	delete updated_agent;
+}
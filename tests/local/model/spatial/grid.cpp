@@ -50,6 +50,55 @@ TEST_F(GridCellTest, location) {
 	ASSERT_EQ(grid_cell.location(), DiscretePoint(12, -7));
 }
 
+class LocalGridTopologyTest : public Test {
+	protected:
+		std::vector<fpmas::model::GridCell> cells;
+		std::shared_ptr<LocalGridTopology<fpmas::model::GridCell>> topology;
+
+		void SetUp() override {
+			// 3x3 block, with a VonNeumann neighborhood
+			topology = std::make_shared<LocalGridTopology<fpmas::model::GridCell>>(
+					DiscretePoint(1, 1), DiscretePoint(4, 4),
+					std::vector<DiscretePoint>({{0, -1}, {-1, 0}, {1, 0}, {0, 1}})
+					);
+			for(DiscreteCoordinate y = 1; y < 4; y++)
+				for(DiscreteCoordinate x = 1; x < 4; x++)
+					cells.emplace_back(DiscretePoint(x, y));
+			for(auto& cell : cells)
+				topology->setCell(cell.location(), &cell);
+		}
+};
+
+TEST_F(LocalGridTopologyTest, cell) {
+	ASSERT_EQ(topology->cell({1, 1}), &cells[0]);
+	ASSERT_EQ(topology->cell({3, 2}), &cells[5]);
+	ASSERT_EQ(topology->cell({0, 1}), nullptr);
+	ASSERT_EQ(topology->cell({3, 4}), nullptr);
+}
+
+TEST_F(LocalGridTopologyTest, successors) {
+	std::vector<fpmas::model::GridCell*> successors;
+	topology->successors({2, 2}, successors);
+	ASSERT_THAT(successors, ElementsAre(
+				&cells[1], &cells[3], &cells[5], &cells[7]));
+
+	successors.clear();
+	topology->successors({1, 1}, successors);
+	ASSERT_THAT(successors, ElementsAre(&cells[1], &cells[3]));
+}
+
+TEST_F(LocalGridTopologyTest, grid_cell_successors) {
+	fpmas::model::GridCell& cell = cells[4];
+	cell.setGridTopology(topology);
+
+	ASSERT_THAT(cell.successors(), ElementsAre(
+				&cells[1], &cells[3], &cells[5], &cells[7]));
+
+	// The topology is preserved by move assignment
+	cell = fpmas::model::GridCell({2, 2});
+	ASSERT_THAT(cell.successors(), SizeIs(4));
+}
+
 #define GRID_CELL_SERIAL_TEST_SUITE(CELL_TYPE)\
 	TEST_F(CELL_TYPE##Test, json) {\
 		nlohmann::json j;\
@@ -104,6 +153,33 @@ TEST_F(GridCellTest, location) {
 		ASSERT_THAT(ptr.get(), WhenDynamicCastTo<CELL_TYPE*>(NotNull()));\
 		delete ptr.get();\
 	}\
+	\
+	TEST_F(CELL_TYPE##Test, ghost_object_pack) {\
+		typedef fpmas::io::datapack::GhostSerializer<\
+			fpmas::api::utils::PtrWrapper<CELL_TYPE::JsonBase>> GhostSerializer;\
+		fpmas::api::utils::PtrWrapper<CELL_TYPE::JsonBase> src(&grid_cell);\
+		fpmas::io::datapack::ObjectPack pack;\
+		Serialize(pack);\
+		fpmas::io::datapack::ObjectPack ghost_pack;\
+		ghost_pack.allocate(GhostSerializer::size(ghost_pack, src));\
+		GhostSerializer::to_datapack(ghost_pack, src);\
+		\
+		/* The random generator is not serialized */\
+		ASSERT_LT(ghost_pack.data().size, pack.data().size);\
+		\
+		fpmas::io::datapack::LightObjectPack light_pack;\
+		Serialize(light_pack);\
+		auto ptr = Unserialize(light_pack);\
+		GhostSerializer::update_datapack(ghost_pack, ptr);\
+		\
+		ASSERT_EQ(\
+				static_cast<CELL_TYPE*>(ptr.get())->location(),\
+				DiscretePoint(12, -7)\
+				);\
+		/* Checks optional cell data equality */\
+		ASSERT_EQ(*static_cast<CELL_TYPE*>(ptr.get()), grid_cell);\
+		delete ptr.get();\
+	}\
 
 
 typedef BaseGridCellTest<model::test::CustomGridCell> CustomGridCellTest;
@@ -298,6 +374,37 @@ TEST_F(GridAgentTest, moveToPointOutOfField) {
 		\
 		delete unserialized_agent.get();\
 	}\
+	\
+	TEST_F(AGENT_TYPE##Test, ghost_object_pack) {\
+		typedef fpmas::io::datapack::GhostSerializer<\
+			fpmas::api::utils::PtrWrapper<AGENT_TYPE::JsonBase>> GhostSerializer;\
+		grid_agent.initLocation(&mock_cell);\
+		fpmas::api::utils::PtrWrapper<AGENT_TYPE::JsonBase> src(&grid_agent);\
+		fpmas::io::datapack::ObjectPack pack;\
+		Serialize(pack);\
+		fpmas::io::datapack::ObjectPack ghost_pack;\
+		ghost_pack.allocate(GhostSerializer::size(ghost_pack, src));\
+		GhostSerializer::to_datapack(ghost_pack, src);\
+		\
+		/* The random generator is not serialized */\
+		ASSERT_LT(ghost_pack.data().size, pack.data().size);\
+		\
+		fpmas::io::datapack::LightObjectPack light_pack;\
+		Serialize(light_pack);\
+		auto ghost_agent = Unserialize(light_pack);\
+		GhostSerializer::update_datapack(ghost_pack, ghost_agent);\
+		\
+		ASSERT_EQ(\
+				static_cast<AGENT_TYPE*>(ghost_agent.get())->locationId(),\
+				mock_cell_id);\
+		ASSERT_EQ(\
+				static_cast<AGENT_TYPE*>(ghost_agent.get())->locationPoint(),\
+				location_point);\
+		/* Checks optional agent data equality */\
+		ASSERT_EQ(*static_cast<AGENT_TYPE*>(ghost_agent.get()), grid_agent);\
+		\
+		delete ghost_agent.get();\
+	}\
 
 namespace {
 	using model::test::GridAgent;
@@ -315,6 +422,35 @@ namespace {
 	 * extension with custom serialization rules.
 	 */
 	GRID_AGENT_SERIAL_TEST_SUITE(GridAgentWithData);
+
+	TEST_F(GridAgentWithDataTest, object_pack_in_place_update) {
+		typedef fpmas::io::datapack::Serializer<
+			fpmas::api::utils::PtrWrapper<GridAgentWithData::JsonBase>> AgentSerializer;
+		grid_agent.data = 14;
+		grid_agent.initLocation(&mock_cell);
+		fpmas::io::datapack::ObjectPack pack;
+		Serialize(pack);
+
+		GridAgentWithData source_agent;
+		fpmas::io::datapack::LightObjectPack light_pack;
+		light_pack = fpmas::api::utils::PtrWrapper<GridAgentWithData::JsonBase>(
+				&source_agent);
+		auto target = Unserialize(light_pack);
+
+		std::size_t from_datapack_count = GridAgentWithData::from_datapack_count;
+		AgentSerializer::update_datapack(
+				pack, static_cast<GridAgentWithData::JsonBase*>(target.get()));
+
+		/* No temporary GridAgentWithData is allocated */
+		ASSERT_EQ(GridAgentWithData::from_datapack_count, from_datapack_count);
+		auto* updated_agent = static_cast<GridAgentWithData*>(target.get());
+		ASSERT_EQ(updated_agent->locationId(), mock_cell_id);
+		ASSERT_EQ(updated_agent->locationPoint(), location_point);
+		ASSERT_EQ(updated_agent->rd(), grid_agent.rd());
+		ASSERT_EQ(updated_agent->data, 14);
+
+		delete target.get();
+	}
 }
 
 TEST(VonNeumannRange, radius_von_neumann_grid) {
@@ -147,6 +147,51 @@ TEST_F(CellBaseTest, update_perceptions) {
 	cell.updatePerceptions(mock_group);
 }
 
+TEST_F(CellBaseTest, update_perceptions_queried) {
+	MockAgentGraph<> mock_graph;
+	ON_CALL(mock_model, graph())
+		.WillByDefault(ReturnRef(mock_graph));
+	EXPECT_CALL(mock_model, graph())
+		.Times(AnyNumber());
+
+	DistributedId perceived_id {5, 2};
+	MockSpatialAgent<DefaultCell>* perceived_agent
+		= new NiceMock<MockSpatialAgent<DefaultCell>>;
+
+	NiceMock<MockAgentGroup> mock_group;
+	ON_CALL(mock_group, groupId())
+		.WillByDefault(Return(0));
+	ON_CALL(*mock_spatial_agent, groupIds)
+		.WillByDefault(Return(std::vector<fpmas::model::GroupId> {mock_group.groupId()}));
+	ON_CALL(*mock_spatial_agent, perceptionMode)
+		.WillByDefault(Return(fpmas::api::model::QUERIED_PERCEPTIONS));
+
+	MockAgentNode<NiceMock> perceived_agent_node {
+		perceived_id, AgentPtr(perceived_agent)};
+	MockAgentEdge<NiceMock> perceived_agent_edge;
+	perceived_agent_edge.setSourceNode(&perceived_agent_node);
+
+	ON_CALL(cell_node, getIncomingEdges(SpatialModelLayers::PERCEIVE))
+		.WillByDefault(Return(std::vector<AgentEdge*>({&agent_edge})));
+	ON_CALL(cell_node, getIncomingEdges(SpatialModelLayers::LOCATION))
+		.WillByDefault(Return(std::vector<AgentEdge*>(
+						{&agent_edge, &perceived_agent_edge}
+						)));
+
+	// A LOCAL perceiver queries the LOCATION layer of the cell
+	agent_node.setState(fpmas::api::graph::LOCAL);
+	EXPECT_CALL(mock_graph, link).Times(0);
+
+	cell.updatePerceptions(mock_group);
+
+	// A DISTANT perceiver handled by the group is always linked
+	agent_node.setState(fpmas::api::graph::DISTANT);
+	EXPECT_CALL(mock_graph, link(
+				&agent_node, &perceived_agent_node, SpatialModelLayers::PERCEPTION));
+
+	cell.updatePerceptions(mock_group);
+}
+
 /*
  * Inheriting from GridAgentType is an hacky trick to get access to protected
  * GridAgentType members (such as moveTo())
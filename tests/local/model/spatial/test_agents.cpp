@@ -16,5 +16,15 @@ namespace model { namespace test {
 	bool operator==(const GridAgent&, const GridAgent&) {
 		return true;
 	}
+
+	std::size_t GridAgentWithData::from_datapack_count = 0;
+
+	bool operator==(const ContinuousAgent& a1, const ContinuousAgent& a2) {
+		return a1.position() == a2.position();
+	}
+
+	fpmas::model::ContinuousSpace ContinuousAgent::space {10, 10, 2};
+	MockRange<MockGridCell>* ContinuousAgent::mobility_range;
+	MockRange<MockGridCell>* ContinuousAgent::perception_range;
 }}
 
@@ -5,6 +5,7 @@
 #include "../../../mocks/model/mock_spatial_model.h"
 #include "fpmas/model/spatial/grid.h"
 #include "fpmas/model/spatial/graph.h"
+#include "fpmas/model/spatial/continuous.h"
 #include "../../../mocks/model/mock_grid.h"
 
 namespace fpmas { namespace model {
@@ -184,13 +185,38 @@ namespace model { namespace test {
 
 			static GridAgentWithData* from_datapack(
 					const fpmas::io::datapack::ObjectPack& pack) {
+				from_datapack_count++;
 				return new GridAgentWithData(pack.get<int>());
 			}
 
+			static void update_datapack(
+					const fpmas::io::datapack::ObjectPack& pack,
+					GridAgentWithData* agent) {
+				agent->data = pack.get<int>();
+			}
+
+			// Count of GridAgentWithData instances allocated by
+			// from_datapack()
+			static std::size_t from_datapack_count;
+
 			bool operator==(const GridAgentWithData& agent) const {
 				return data == agent.data;
 			}
 	};
+
+	class ContinuousAgent :
+		public fpmas::model::ContinuousAgent<ContinuousAgent, MockGridCell> {
+			public:
+				static fpmas::model::ContinuousSpace space;
+				static MockRange<MockGridCell>* mobility_range;
+				static MockRange<MockGridCell>* perception_range;
+
+				FPMAS_CONTINUOUS_SPACE(space);
+				FPMAS_MOBILITY_RANGE(*mobility_range);
+				FPMAS_PERCEPTION_RANGE(*perception_range);
+		};
+
+	bool operator==(const ContinuousAgent&, const ContinuousAgent&);
 }}
 
 FPMAS_DEFAULT_JSON(model::test::SpatialAgent);
@@ -199,4 +225,7 @@ FPMAS_DEFAULT_DATAPACK(::model::test::SpatialAgent);
 FPMAS_DEFAULT_JSON(model::test::GridAgent);
 FPMAS_DEFAULT_DATAPACK(::model::test::GridAgent);
 
+FPMAS_DEFAULT_JSON(model::test::ContinuousAgent);
+FPMAS_DEFAULT_DATAPACK(::model::test::ContinuousAgent);
+
 #endif
@@ -9,6 +9,8 @@
 using namespace testing;
 
 using fpmas::synchro::NodeUpdatePack;
+using fpmas::api::communication::DataPack;
+using fpmas::io::datapack::ObjectPack;
 
 using fpmas::synchro::ghost::GhostDataSync;
 
@@ -27,13 +29,12 @@ class GhostDataSyncTest : public Test {
 
 		static const int current_rank = 3;
 		MockMpiCommunicator<current_rank, 10> mock_comm;
-		MockMpi<fpmas::synchro::NodeUpdatePack<int>> data_mpi {mock_comm};
 		MockMpi<DistributedId> id_mpi {mock_comm};
 		MockMpi<std::pair<DistributedId, int>> location_mpi {mock_comm};
 		MockDistributedGraph<int, NodeType, EdgeType, NiceMock> mocked_graph;
 
 		GhostDataSync<int>
-			data_sync {data_mpi, id_mpi, mocked_graph};
+			data_sync {id_mpi, mocked_graph};
 
 		NiceMock<MockLocationManager<int>> location_manager {mock_comm, id_mpi, location_mpi};
 
@@ -67,6 +68,32 @@ class GhostDataSyncTest : public Test {
 
 		}
 
+		/*
+		 * Serializes NodeUpdatePacks with the format used by GhostDataSync.
+		 */
+		static std::unordered_map<int, DataPack> pack(
+				const std::unordered_map<int, std::vector<NodeUpdatePack<int>>>& data) {
+			std::unordered_map<int, DataPack> packs;
+			for(auto& item : data)
+				packs.emplace(item.first, ObjectPack(item.second).dump());
+			return packs;
+		}
+
+		/*
+		 * Unserializes DataPacks exported by GhostDataSync.
+		 */
+		static std::unordered_map<int, std::vector<NodeUpdatePack<int>>> unpack(
+				const std::unordered_map<int, DataPack>& packs) {
+			std::unordered_map<int, std::vector<NodeUpdatePack<int>>> data;
+			for(auto& item : packs)
+				data.emplace(
+						item.first,
+						ObjectPack::parse(item.second)
+						.get<std::vector<NodeUpdatePack<int>>>()
+						);
+			return data;
+		}
+
 		void setUpGraphNodes(NodeMap& graph_nodes) {
 			ON_CALL(mocked_graph, getNodes)
 				.WillByDefault(ReturnRef(graph_nodes));
@@ -106,7 +133,9 @@ TEST_F(GhostDataSyncTest, export_test) {
 		Pair(1, ElementsAre(NodeUpdatePack<int>(DistributedId(2, 0), nodes[0]->data(), 2.8f))),
 		Pair(5, ElementsAre(NodeUpdatePack<int>(DistributedId(6, 2), nodes[2]->data(), 0.4f)))
 		);
-	EXPECT_CALL(data_mpi, migrate(export_node_matcher));
+	EXPECT_CALL(mock_comm, allToAll(
+				ResultOf(&GhostDataSyncTest::unpack, export_node_matcher), MPI_CHAR
+				));
 
 	EXPECT_CALL(*node_mutexes[0], synchronize);
 	EXPECT_CALL(*node_mutexes[2], synchronize);
@@ -147,8 +176,8 @@ TEST_F(GhostDataSyncTest, import_test) {
 		{0, {{DistributedId(0, 0), 12, 14.6f}, {DistributedId(6, 2), 56, 7.2f}}},
 		{9, {{DistributedId(7, 1), 125, 2.2f}}}
 	};
-	EXPECT_CALL(data_mpi, migrate(IsEmpty()))
-		.WillOnce(Return(updated_data));
+	EXPECT_CALL(mock_comm, allToAll(IsEmpty(), MPI_CHAR))
+		.WillOnce(Return(pack(updated_data)));
 
 	EXPECT_CALL(*nodes[1], setWeight(14.6));
 	EXPECT_CALL(*nodes[2], setWeight(7.2));
@@ -204,8 +233,8 @@ TEST_F(GhostDataSyncTest, partial_import_test) {
 		{0, {{DistributedId(0, 0), 12, 14.6f}}},
 		{9, {{DistributedId(7, 1), 125, 2.2f}}}
 	};
-	EXPECT_CALL(data_mpi, migrate(IsEmpty()))
-		.WillOnce(Return(updated_data));
+	EXPECT_CALL(mock_comm, allToAll(IsEmpty(), MPI_CHAR))
+		.WillOnce(Return(pack(updated_data)));
 
 	EXPECT_CALL(*nodes[1], setWeight(14.6));
 	EXPECT_CALL(*nodes[2], setWeight(7.2)).Times(0); // not updated
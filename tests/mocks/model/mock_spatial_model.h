@@ -28,6 +28,7 @@ class MockSpatialAgent :
 			MOCK_METHOD(void, handleNewPerceive, (), (override));
 			MOCK_METHOD(const fpmas::api::model::Range<CellType>&, mobilityRange, (), (const, override));
 			MOCK_METHOD(const fpmas::api::model::Range<CellType>&, perceptionRange, (), (const, override));
+			MOCK_METHOD(fpmas::api::model::PerceptionMode, perceptionMode, (), (const, override));
 	};
 
 
@@ -0,0 +1,101 @@
+#include "fpmas/model/spatial/continuous.h"
+#include "fpmas/communication/communication.h"
+#include "fpmas/graph/random_load_balancing.h"
+#include "fpmas/synchro/ghost/ghost_mode.h"
+#include "gmock/gmock.h"
+#include "../test_agents.h"
+
+using namespace testing;
+using fpmas::model::ContinuousPoint;
+
+class ContinuousSpaceTest : public Test {
+	protected:
+		fpmas::model::GridModel<fpmas::synchro::GhostMode> model;
+		fpmas::model::Behavior<TestContinuousAgent> behavior {
+			&TestContinuousAgent::move};
+		fpmas::api::model::MoveAgentGroup<fpmas::model::GridCell>& move_group {
+			model.buildMoveGroup(0, behavior)};
+
+		void SetUp() override {
+			TestContinuousAgent::space = fpmas::model::ContinuousSpace(
+					6*model.getMpiCommunicator().getSize(), 6, 1);
+			fpmas::model::ContinuousSpaceBuilder<> builder(TestContinuousAgent::space);
+			auto bins = builder.build(model);
+
+			// Random positions in each local bin
+			fpmas::random::mt19937_64 rd(model.getMpiCommunicator().getRank());
+			fpmas::random::UniformRealDistribution<> offset(0, 1);
+			for(auto bin : bins) {
+				for(int i = 0; i < 2; i++) {
+					auto agent = new TestContinuousAgent;
+					move_group.add(agent);
+					agent->initLocation(bin, {
+							bin->location().x + offset(rd),
+							bin->location().y + offset(rd)
+							});
+				}
+			}
+			model.runtime().execute(move_group.distributedMoveAlgorithm().jobs());
+		}
+
+		void checkPerceptions() {
+			std::vector<std::pair<DistributedId, ContinuousPoint>> local_positions;
+			for(auto agent : move_group.localAgents()) {
+				auto continuous_agent = dynamic_cast<TestContinuousAgent*>(agent);
+				// The location of the agent is consistent with its position
+				ASSERT_EQ(
+						TestContinuousAgent::space.bin(continuous_agent->position()),
+						continuous_agent->locationPoint());
+				local_positions.push_back({
+						agent->node()->getId(), continuous_agent->position()
+						});
+			}
+			fpmas::communication::TypedMpi<decltype(local_positions)> mpi(
+					model.getMpiCommunicator());
+			auto all_positions = fpmas::communication::all_reduce(
+					mpi, local_positions, fpmas::utils::Concat());
+
+			for(auto radius : {0.5, 1., TestContinuousAgent::perception_radius}) {
+				for(auto agent : move_group.localAgents()) {
+					auto continuous_agent = dynamic_cast<TestContinuousAgent*>(agent);
+
+					std::vector<DistributedId> expected_perceptions;
+					for(auto& item : all_positions)
+						if(item.first != agent->node()->getId()
+								&& fpmas::api::model::euclidian_distance(
+									continuous_agent->position(), item.second
+									) <= radius)
+							expected_perceptions.push_back(item.first);
+					ASSERT_THAT(
+							continuous_agent->perceivedIdsWithin(radius),
+							UnorderedElementsAreArray(expected_perceptions));
+				}
+			}
+		}
+};
+
+TEST_F(ContinuousSpaceTest, perceptions_within) {
+	checkPerceptions();
+
+	for(int i = 0; i < 10; i++) {
+		model.runtime().execute(move_group.jobs());
+		checkPerceptions();
+	}
+}
+
+TEST_F(ContinuousSpaceTest, distribute) {
+	// Bins and agents are migrated in batches
+	fpmas::graph::RandomLoadBalancing<fpmas::api::model::AgentPtr> random_lb(
+			model.getMpiCommunicator()
+			);
+	model.graph().distribute(
+			random_lb.balance(model.graph().getLocationManager().getLocalNodes())
+			);
+	model.runtime().execute(move_group.distributedMoveAlgorithm().jobs());
+	checkPerceptions();
+
+	for(int i = 0; i < 5; i++) {
+		model.runtime().execute(move_group.jobs());
+		checkPerceptions();
+	}
+}
@@ -5,6 +5,7 @@
 #include "fpmas/model/spatial/von_neumann.h"
 #include "fpmas/model/spatial/moore.h"
 #include "fpmas/model/spatial/von_neumann_grid.h"
+#include "fpmas/graph/random_load_balancing.h"
 #include "fpmas/synchro/hard/hard_sync_mode.h"
 #include "fpmas/synchro/ghost/ghost_mode.h"
 #include "gmock/gmock.h"
@@ -134,6 +135,20 @@ class GridBuilderTestBase : public Test {
 			grid_model.graph().synchronize();
 		}
 
+		/*
+		 * In the IMPLICIT_TOPOLOGY mode, CELL_SUCCESSOR edges are only built
+		 * to the DISTANT frontier of the local grid.
+		 */
+		void checkImplicitTopology(std::vector<fpmas::model::GridCell*> cells) {
+			for(auto cell : cells)
+				for(auto edge : cell->node()->getOutgoingEdges(
+							fpmas::api::model::CELL_SUCCESSOR))
+					ASSERT_EQ(
+							edge->getTargetNode()->state(),
+							fpmas::api::graph::DISTANT
+							);
+		}
+
 
 };
 
@@ -403,6 +418,22 @@ TEST_F(VonNeumannGridBuilderTest, build_with_groups) {
 	}
 }
 
+TEST_F(VonNeumannGridBuilderTest, implicit_topology) {
+	GridModel<fpmas::synchro::GhostMode, fpmas::model::GridCell,
+		StaticEndCondition<VonNeumannRange<VonNeumannGrid<>>, 0, fpmas::model::GridCell>
+			> grid_model;
+
+	int X = fpmas::communication::WORLD.getSize() * 10;
+	int Y = 2*X + 1;
+	VonNeumannGridBuilder<> grid_builder(X, Y, IMPLICIT_TOPOLOGY);
+	ASSERT_EQ(grid_builder.topologyMode(), IMPLICIT_TOPOLOGY);
+
+	auto cells = grid_builder.build(grid_model);
+
+	checkImplicitTopology(cells);
+	checkGridStructure(grid_model, cells, X, Y);
+}
+
 class MooreGridBuilderTest : public GridBuilderTestBase {
 	private:
 		void checkGrid(
@@ -696,6 +727,155 @@ TEST_F(MooreGridBuilderTest, build_with_groups) {
 	}
 }
 
+TEST_F(MooreGridBuilderTest, implicit_topology) {
+	GridModel<fpmas::synchro::GhostMode, fpmas::model::GridCell,
+		StaticEndCondition<VonNeumannRange<MooreGrid<>>, 0, fpmas::model::GridCell>
+			> grid_model;
+
+	int X = fpmas::communication::WORLD.getSize() * 10;
+	int Y = 2*X + 1;
+	MooreGridBuilder<> grid_builder(X, Y, IMPLICIT_TOPOLOGY);
+
+	auto cells = grid_builder.build(grid_model);
+
+	checkImplicitTopology(cells);
+	checkGridStructure(grid_model, cells, X, Y);
+}
+
+TEST_F(MooreGridBuilderTest, implicit_topology_hard_sync_mode) {
+	GridModel<fpmas::synchro::HardSyncMode, fpmas::model::GridCell,
+		StaticEndCondition<VonNeumannRange<MooreGrid<>>, 0, fpmas::model::GridCell>
+			> grid_model;
+
+	int Y = fpmas::communication::WORLD.getSize() * 10;
+	int X = 2*Y + 1;
+	MooreGridBuilder<> grid_builder(X, Y, IMPLICIT_TOPOLOGY);
+
+	auto cells = grid_builder.build(grid_model);
+
+	checkImplicitTopology(cells);
+	checkGridStructure(grid_model, cells, X, Y);
+}
+
+TEST(ImplicitTopologyGridTest, distributed_move_algorithm) {
+	fpmas::model::GridModel<fpmas::synchro::GhostMode> model;
+	int X = model.getMpiCommunicator().getSize() * 4;
+	int Y = 6;
+	fpmas::model::VonNeumannGridBuilder<> grid_builder(X, Y, IMPLICIT_TOPOLOGY);
+	auto cells = grid_builder.build(model);
+
+	fpmas::model::Behavior<TestGridAgent> behavior(&TestGridAgent::move);
+	auto& move_group = model.buildMoveGroup(0, behavior);
+	for(auto cell : cells) {
+		auto agent = new TestGridAgent;
+		move_group.add(agent);
+		agent->initLocation(cell);
+	}
+	model.runtime().execute(move_group.distributedMoveAlgorithm().jobs());
+
+	for(int i = 0; i < 5; i++) {
+		model.runtime().execute(move_group.jobs());
+
+		for(auto agent : move_group.localAgents()) {
+			auto grid_agent = dynamic_cast<TestGridAgent*>(agent);
+			auto location = grid_agent->locationPoint();
+			std::vector<fpmas::model::DiscretePoint> expected_field;
+			for(auto point : std::vector<fpmas::model::DiscretePoint>({
+						location,
+						{location.x-1, location.y}, {location.x+1, location.y},
+						{location.x, location.y-1}, {location.x, location.y+1}
+						}))
+				if(point.x >= 0 && point.x < X && point.y >= 0 && point.y < Y)
+					expected_field.push_back(point);
+
+			std::vector<fpmas::model::DiscretePoint> mobility_field;
+			for(auto edge : grid_agent->node()->getOutgoingEdges(
+						fpmas::api::model::MOVE))
+				mobility_field.push_back(dynamic_cast<fpmas::model::GridCell*>(
+							edge->getTargetNode()->data().get())->location());
+			ASSERT_THAT(mobility_field, UnorderedElementsAreArray(expected_field));
+		}
+	}
+}
+
+TEST(QueriedPerceptionsGridTest, distributed_move_algorithm) {
+	fpmas::model::GridModel<fpmas::synchro::GhostMode> model;
+	int X = model.getMpiCommunicator().getSize() * 4;
+	int Y = 6;
+	fpmas::model::VonNeumannGridBuilder<> grid_builder(X, Y);
+	auto cells = grid_builder.build(model);
+
+	fpmas::model::Behavior<TestQueriedGridAgent> behavior(&TestQueriedGridAgent::move);
+	auto& move_group = model.buildMoveGroup(0, behavior);
+	// Two agents on half of the cells
+	for(std::size_t i = 0; i < cells.size(); i+=2) {
+		for(int j = 0; j < 2; j++) {
+			auto agent = new TestQueriedGridAgent;
+			move_group.add(agent);
+			agent->initLocation(cells[i]);
+		}
+	}
+	model.runtime().execute(move_group.distributedMoveAlgorithm().jobs());
+
+	auto check_perceptions = [&model, &move_group] () {
+		std::vector<std::pair<DistributedId, DiscretePoint>> local_locations;
+		for(auto agent : move_group.localAgents())
+			local_locations.push_back({
+					agent->node()->getId(),
+					dynamic_cast<TestQueriedGridAgent*>(agent)->locationPoint()
+					});
+		fpmas::communication::TypedMpi<decltype(local_locations)> mpi(
+				model.getMpiCommunicator());
+		auto all_locations = fpmas::communication::all_reduce(
+				mpi, local_locations, fpmas::utils::Concat());
+		std::unordered_map<DistributedId, DiscretePoint> locations(
+				all_locations.begin(), all_locations.end());
+
+		fpmas::model::ManhattanDistance distance;
+		for(auto agent : move_group.localAgents()) {
+			auto grid_agent = dynamic_cast<TestQueriedGridAgent*>(agent);
+			auto location = grid_agent->locationPoint();
+
+			std::vector<DistributedId> expected_perceptions;
+			for(auto& item : locations)
+				if(item.first != agent->node()->getId()
+						&& distance(location, item.second) <= 1)
+					expected_perceptions.push_back(item.first);
+			ASSERT_THAT(
+					grid_agent->perceivedIds(),
+					UnorderedElementsAreArray(expected_perceptions));
+
+			// No PERCEPTION edge is built for LOCAL perceived cells
+			std::set<DiscretePoint> local_perceived_points;
+			for(auto edge : agent->node()->getOutgoingEdges(fpmas::api::model::PERCEIVE))
+				if(edge->getTargetNode()->state() == fpmas::api::graph::LOCAL)
+					local_perceived_points.insert(dynamic_cast<fpmas::model::GridCell*>(
+								edge->getTargetNode()->data().get())->location());
+			for(auto edge : agent->node()->getOutgoingEdges(fpmas::api::model::PERCEPTION))
+				ASSERT_THAT(
+						local_perceived_points,
+						Not(Contains(locations[edge->getTargetNode()->getId()])));
+		}
+	};
+	check_perceptions();
+
+	for(int i = 0; i < 5; i++) {
+		model.runtime().execute(move_group.jobs());
+		check_perceptions();
+	}
+
+	// Random distribution: cells that were LOCAL to perceivers might become
+	// DISTANT, so PERCEPTION edges must be rebuilt
+	fpmas::graph::RandomLoadBalancing<fpmas::api::model::AgentPtr> random_lb(
+			model.getMpiCommunicator()
+			);
+	model.graph().distribute(
+			random_lb.balance(model.graph().getLocationManager().getLocalNodes())
+			);
+	model.runtime().execute(move_group.distributedMoveAlgorithm().jobs());
+	check_perceptions();
+}
+
 class GridBuilderTest : public Test {
 	protected:
 		fpmas::model::GridModel<fpmas::synchro::GhostMode> model;
@@ -0,0 +1,113 @@
+#include "gmock/gmock.h"
+#include "fpmas/synchro/ghost/ghost_mode.h"
+#include "fpmas/synchro/hard/hard_sync_mode.h"
+#include "fpmas/model/spatial/grid_move_algo.h"
+#include "fpmas/model/spatial/von_neumann.h"
+#include "../test_agents.h"
+
+using namespace testing;
+
+template<template<typename> class SyncMode>
+class GridMoveAlgorithmTest : public Test {
+	protected:
+		fpmas::model::GridModel<SyncMode> model;
+		fpmas::model::DiscreteCoordinate X = model.getMpiCommunicator().getSize() * 4;
+		fpmas::model::DiscreteCoordinate Y = 6;
+		fpmas::model::Behavior<TestGridAgent> behavior {&TestGridAgent::move};
+		fpmas::model::MoveAgentGroup<fpmas::model::GridCell>& move_group
+			= model.buildMoveGroup(0, behavior);
+		fpmas::model::GridMoveAlgorithm<fpmas::model::GridCell> grid_move_algo {
+			model, move_group, X, Y
+		};
+
+		void build(fpmas::model::GridTopologyMode topology_mode) {
+			fpmas::model::VonNeumannGridBuilder<> grid_builder(X, Y, topology_mode);
+			auto cells = grid_builder.build(model);
+			move_group.setDistributedMoveAlgorithm(grid_move_algo);
+
+			// Two agents on half of the cells
+			for(std::size_t i = 0; i < cells.size(); i+=2) {
+				for(int j = 0; j < 2; j++) {
+					auto agent = new TestGridAgent;
+					move_group.add(agent);
+					agent->initLocation(cells[i]);
+				}
+			}
+			model.runtime().execute(move_group.distributedMoveAlgorithm().jobs());
+		}
+
+		/*
+		 * Checks that mobility fields and perceptions correspond to the
+		 * VonNeumann range of size 1 of each agent.
+		 */
+		void checkFields() {
+			std::vector<std::pair<fpmas::model::DistributedId, fpmas::model::DiscretePoint>>
+				local_locations;
+			for(auto agent : move_group.localAgents())
+				local_locations.push_back({
+						agent->node()->getId(),
+						dynamic_cast<TestGridAgent*>(agent)->locationPoint()
+						});
+			fpmas::communication::TypedMpi<decltype(local_locations)> mpi(
+					model.getMpiCommunicator());
+			auto locations = fpmas::communication::all_reduce(
+					mpi, local_locations, fpmas::utils::Concat());
+
+			fpmas::model::ManhattanDistance distance;
+			for(auto agent : move_group.localAgents()) {
+				auto grid_agent = dynamic_cast<TestGridAgent*>(agent);
+				auto location = grid_agent->locationPoint();
+
+				std::vector<fpmas::model::DiscretePoint> expected_field;
+				for(fpmas::model::DiscreteCoordinate x = 0; x < X; x++)
+					for(fpmas::model::DiscreteCoordinate y = 0; y < Y; y++)
+						if(distance(location, {x, y}) <= 1)
+							expected_field.push_back({x, y});
+				std::vector<fpmas::model::DiscretePoint> mobility_field;
+				for(auto edge : agent->node()->getOutgoingEdges(fpmas::api::model::MOVE))
+					mobility_field.push_back(dynamic_cast<fpmas::model::GridCell*>(
+								edge->getTargetNode()->data().get())->location());
+				ASSERT_THAT(mobility_field, UnorderedElementsAreArray(expected_field));
+
+				std::vector<fpmas::model::DiscretePoint> perception_field;
+				for(auto edge : agent->node()->getOutgoingEdges(fpmas::api::model::PERCEIVE))
+					perception_field.push_back(dynamic_cast<fpmas::model::GridCell*>(
+								edge->getTargetNode()->data().get())->location());
+				ASSERT_THAT(perception_field, UnorderedElementsAreArray(expected_field));
+
+				std::vector<fpmas::model::DistributedId> expected_perceptions;
+				for(auto& item : locations)
+					if(item.first != agent->node()->getId()
+							&& distance(location, item.second) <= 1)
+						expected_perceptions.push_back(item.first);
+				std::vector<fpmas::model::DistributedId> perceptions;
+				for(auto edge : agent->node()->getOutgoingEdges(fpmas::api::model::PERCEPTION))
+					perceptions.push_back(edge->getTargetNode()->getId());
+				ASSERT_THAT(perceptions, UnorderedElementsAreArray(expected_perceptions));
+			}
+		}
+
+		void run(fpmas::model::GridTopologyMode topology_mode) {
+			build(topology_mode);
+			checkFields();
+			for(int i = 0; i < 5; i++) {
+				model.runtime().execute(move_group.jobs());
+				checkFields();
+			}
+		}
+};
+
+typedef GridMoveAlgorithmTest<fpmas::synchro::GhostMode> GridMoveAlgorithmTest_GhostMode;
+typedef GridMoveAlgorithmTest<fpmas::synchro::HardSyncMode> GridMoveAlgorithmTest_HardSyncMode;
+
+TEST_F(GridMoveAlgorithmTest_GhostMode, explicit_topology) {
+	run(fpmas::model::EXPLICIT_TOPOLOGY);
+}
+
+TEST_F(GridMoveAlgorithmTest_GhostMode, implicit_topology) {
+	run(fpmas::model::IMPLICIT_TOPOLOGY);
+}
+
+TEST_F(GridMoveAlgorithmTest_HardSyncMode, explicit_topology) {
+	run(fpmas::model::EXPLICIT_TOPOLOGY);
+}
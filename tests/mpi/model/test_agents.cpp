@@ -1,6 +1,35 @@
 #include "test_agents.h"
+#include "fpmas/random/distribution.h"
 
 const fpmas::model::Behavior<TestSpatialAgent> TestSpatialAgent::behavior {
 	&TestSpatialAgent::moveToNextCell};
 
 fpmas::model::VonNeumannRange<fpmas::model::VonNeumannGrid<>> TestGridAgent::range(1);
+fpmas::model::VonNeumannRange<fpmas::model::VonNeumannGrid<>> TestQueriedGridAgent::range(1);
+
+fpmas::model::ContinuousSpace TestContinuousAgent::space(10, 10, 1);
+fpmas::model::ContinuousCoordinate TestContinuousAgent::speed = 1;
+fpmas::model::ContinuousCoordinate TestContinuousAgent::perception_radius = 1.5;
+fpmas::model::ContinuousRange<> TestContinuousAgent::mobility_range(
+		TestContinuousAgent::space, TestContinuousAgent::speed);
+fpmas::model::ContinuousRange<> TestContinuousAgent::perception_range(
+		TestContinuousAgent::space, TestContinuousAgent::perception_radius);
+
+void TestContinuousAgent::move() {
+	// Any point in the square is within speed
+	fpmas::random::UniformRealDistribution<> d(-speed/std::sqrt(2), speed/std::sqrt(2));
+	fpmas::model::ContinuousPoint target(
+			this->position().x + d(this->rd()),
+			this->position().y + d(this->rd())
+			);
+	if(space.contains(target))
+		this->moveTo(target);
+}
+
+std::vector<fpmas::api::graph::DistributedId> TestContinuousAgent::perceivedIdsWithin(
+		fpmas::model::ContinuousCoordinate radius) const {
+	std::vector<fpmas::api::graph::DistributedId> ids;
+	for(auto agent : this->perceptionsWithin(radius))
+		ids.push_back(agent->node()->getId());
+	return ids;
+}
@@ -3,6 +3,7 @@
 
 #include "fpmas/model/spatial/spatial_model.h"
 #include "fpmas/model/spatial/grid.h"
+#include "fpmas/model/spatial/continuous.h"
 #include "fpmas/model/spatial/graph.h"
 #include "fpmas/model/spatial/von_neumann.h"
 #include "../../mocks/model/mock_model.h"
@@ -10,7 +11,8 @@
 #define TEST_AGENTS BasicAgent, ReaderAgent, WriterAgent, LinkerAgent,\
 		DefaultMockAgentBase<1>, DefaultMockAgentBase<10>,\
 		TestCell, TestSpatialAgent::JsonBase, fpmas::model::GridCell::JsonBase,\
-		TestGridAgent::JsonBase,\
+		TestGridAgent::JsonBase, TestQueriedGridAgent::JsonBase,\
+		TestContinuousAgent::JsonBase,\
 		fpmas::model::GraphCell::JsonBase
 
 using testing::Ge;
@@ -366,10 +368,58 @@ class TestGridAgent : public fpmas::model::GridAgent<TestGridAgent> {
 	}
 };
 
+/*
+ * Same as TestGridAgent, but perceptions are queried.
+ */
+class TestQueriedGridAgent : public fpmas::model::GridAgent<TestQueriedGridAgent> {
+	static fpmas::model::VonNeumannRange<fpmas::model::VonNeumannGrid<>> range;
+
+	public:
+	FPMAS_MOBILITY_RANGE(range);
+	FPMAS_PERCEPTION_RANGE(range);
+	FPMAS_PERCEPTION_MODE(fpmas::api::model::QUERIED_PERCEPTIONS);
+
+	void move() {
+		this->moveTo(this->mobilityField().random());
+	}
+
+	std::vector<fpmas::api::graph::DistributedId> perceivedIds() const {
+		std::vector<fpmas::api::graph::DistributedId> ids;
+		for(auto agent : this->perceptions())
+			ids.push_back(agent->node()->getId());
+		return ids;
+	}
+};
+
+/*
+ * Agent randomly moving in a ContinuousSpace.
+ */
+class TestContinuousAgent : public fpmas::model::ContinuousAgent<TestContinuousAgent> {
+	public:
+	static fpmas::model::ContinuousSpace space;
+	static fpmas::model::ContinuousCoordinate speed;
+	static fpmas::model::ContinuousCoordinate perception_radius;
+	static fpmas::model::ContinuousRange<> mobility_range;
+	static fpmas::model::ContinuousRange<> perception_range;
+
+	FPMAS_CONTINUOUS_SPACE(space);
+	FPMAS_MOBILITY_RANGE(mobility_range);
+	FPMAS_PERCEPTION_RANGE(perception_range);
+
+	void move();
+
+	std::vector<fpmas::api::graph::DistributedId> perceivedIdsWithin(
+			fpmas::model::ContinuousCoordinate radius) const;
+};
+
 FPMAS_DEFAULT_JSON(DefaultMockAgentBase<1>);
 FPMAS_DEFAULT_JSON(DefaultMockAgentBase<10>);
 FPMAS_DEFAULT_JSON(TestGridAgent);
+FPMAS_DEFAULT_JSON(TestQueriedGridAgent);
+FPMAS_DEFAULT_JSON(TestContinuousAgent);
 FPMAS_DEFAULT_DATAPACK(DefaultMockAgentBase<1>);
 FPMAS_DEFAULT_DATAPACK(DefaultMockAgentBase<10>);
 FPMAS_DEFAULT_DATAPACK(TestGridAgent);
+FPMAS_DEFAULT_DATAPACK(TestQueriedGridAgent);
+FPMAS_DEFAULT_DATAPACK(TestContinuousAgent);
 #endif
@@ -41,4 +41,47 @@ struct CustomAgentWithLightPack : public CustomAgentBase<CustomAgentWithLightPac
 		CustomAgentBase(data), very_important_data(very_important_data) {
 		}
 };
+
+struct CustomAgentWithGhostPack : public CustomAgentBase<CustomAgentWithGhostPack> {
+	std::vector<int> history;
+
+	CustomAgentWithGhostPack(float data, std::vector<int> history) :
+		CustomAgentBase(data), history(history) {
+		}
+
+	static std::size_t size(
+			const fpmas::io::datapack::ObjectPack& p,
+			const CustomAgentWithGhostPack* agent) {
+		return p.size(agent->data) + p.size(agent->history);
+	}
+	static void to_datapack(
+			fpmas::io::datapack::ObjectPack& p,
+			const CustomAgentWithGhostPack* agent) {
+		p.put(agent->data);
+		p.put(agent->history);
+	}
+	static CustomAgentWithGhostPack* from_datapack(
+			const fpmas::io::datapack::ObjectPack& p) {
+		float data = p.get<float>();
+		std::vector<int> history = p.get<std::vector<int>>();
+		return new CustomAgentWithGhostPack(data, history);
+	}
+
+	// Only data is read by DISTANT agents
+	static std::size_t ghost_size(
+			const fpmas::io::datapack::ObjectPack& p,
+			const CustomAgentWithGhostPack* agent) {
+		return p.size(agent->data);
+	}
+	static void ghost_to_datapack(
+			fpmas::io::datapack::ObjectPack& p,
+			const CustomAgentWithGhostPack* agent) {
+		p.put(agent->data);
+	}
+	static void ghost_update_datapack(
+			const fpmas::io::datapack::ObjectPack& p,
+			CustomAgentWithGhostPack* agent) {
+		agent->data = p.get<float>();
+	}
+};
 #endif
@@ -3,7 +3,8 @@
 
 FPMAS_DATAPACK_SET_UP(
 		MockAgent<4>, MockAgent<12>,
-		CustomAgent, DefaultConstructibleCustomAgent, CustomAgentWithLightPack
+		CustomAgent, DefaultConstructibleCustomAgent, CustomAgentWithLightPack,
+		CustomAgentWithGhostPack
 		);
 
 
@@ -62,10 +63,58 @@ TEST(AgentSerializer, light_json_fallback) {
 			);
 }
 
+// Only the ghost fields of a DISTANT agent are serialized and updated
+TEST(AgentSerializer, ghost_object_pack) {
+	typedef fpmas::io::datapack::GhostSerializer<fpmas::api::model::AgentPtr>
+		GhostSerializer;
+	fpmas::api::model::AgentPtr local_agent {
+		new CustomAgentWithGhostPack(2.4f, {1, 2, 3})};
+	fpmas::api::model::Agent* local_agent_ptr = local_agent.get();
+	fpmas::api::model::AgentPtr updated_agent {
+		new CustomAgentWithGhostPack(8.7f, {4, 5, 6, 7, 8})};
+
+	fpmas::io::datapack::ObjectPack full_pack = updated_agent;
+	fpmas::io::datapack::ObjectPack ghost_pack;
+	ghost_pack.allocate(GhostSerializer::size(ghost_pack, updated_agent));
+	GhostSerializer::to_datapack(ghost_pack, updated_agent);
+
+	ASSERT_LT(ghost_pack.data().size, full_pack.data().size);
+
+	fpmas::synchro::DataUpdate<fpmas::api::model::AgentPtr>::update(
+			local_agent, ghost_pack);
+
+	ASSERT_EQ(local_agent.get(), local_agent_ptr);
+	auto* agent = dynamic_cast<CustomAgentWithGhostPack*>(local_agent.get());
+	ASSERT_FLOAT_EQ(agent->getData(), 8.7f);
+	// Not part of the ghost data
+	ASSERT_THAT(agent->history, ElementsAre(1, 2, 3));
+}
+
+// Agent types without ghost serialization rules are fully serialized
+TEST(AgentSerializer, ghost_object_pack_fallback) {
+	typedef fpmas::io::datapack::GhostSerializer<fpmas::api::model::AgentPtr>
+		GhostSerializer;
+	fpmas::api::model::AgentPtr local_agent {new CustomAgent(2.4f)};
+	fpmas::api::model::AgentPtr updated_agent {new CustomAgent(8.7f)};
+
+	fpmas::io::datapack::ObjectPack full_pack = updated_agent;
+	fpmas::io::datapack::ObjectPack ghost_pack;
+	ghost_pack.allocate(GhostSerializer::size(ghost_pack, updated_agent));
+	GhostSerializer::to_datapack(ghost_pack, updated_agent);
+
+	ASSERT_EQ(ghost_pack.data().size, full_pack.data().size);
+
+	fpmas::synchro::DataUpdate<fpmas::api::model::AgentPtr>::update(
+			local_agent, ghost_pack);
+	ASSERT_FLOAT_EQ(
+			dynamic_cast<CustomAgent*>(local_agent.get())->getData(), 8.7f);
+}
+
 int main(int argc, char** argv) {
 	FPMAS_REGISTER_AGENT_TYPES(
 		MockAgent<4>, MockAgent<12>,
-		CustomAgent, DefaultConstructibleCustomAgent, CustomAgentWithLightPack
+		CustomAgent, DefaultConstructibleCustomAgent, CustomAgentWithLightPack,
+		CustomAgentWithGhostPack
 		);
 
 	std::cout << "Running AgentPtr datapack only test suit (FPMAS " << FPMAS_VERSION << ")" << std::endl;
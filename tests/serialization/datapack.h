@@ -120,6 +120,42 @@ TEST(AgentSerializer, object_pack) {
 	ASSERT_THAT(agent_ptr_12->groupIds(), UnorderedElementsAre(4, 90));
 }
 
+TEST(AgentSerializer, object_pack_type_id) {
+	fpmas::api::model::AgentPtr agent_ptr {new MockAgent<12>(3)};
+
+	fpmas::io::datapack::ObjectPack p = agent_ptr;
+
+	FPMAS_TYPE_INDEX type_id;
+	ASSERT_TRUE(fpmas::io::datapack::Serializer<std::type_index>::find_id(
+				MockAgent<12>::TYPE_ID, type_id));
+	// The registered type id is serialized first
+	ASSERT_EQ(p.get<FPMAS_TYPE_INDEX>(), type_id);
+}
+
+TEST(AgentSerializer, object_pack_unregistered_type) {
+	fpmas::api::model::AgentPtr agent_ptr {new MockAgent<1>};
+
+	ASSERT_THROW(
+			fpmas::io::datapack::ObjectPack p = agent_ptr,
+			fpmas::exceptions::BadTypeException
+			);
+}
+
+TEST(AgentSerializer, object_pack_in_place_update) {
+	fpmas::api::model::AgentPtr local_agent {new CustomAgent(2.4f)};
+	fpmas::api::model::Agent* local_agent_ptr = local_agent.get();
+	fpmas::api::model::AgentPtr updated_agent {new CustomAgent(8.7f)};
+
+	fpmas::io::datapack::ObjectPack p = updated_agent;
+	fpmas::synchro::DataUpdate<fpmas::api::model::AgentPtr>::update(
+			local_agent, p);
+
+	// The local agent instance is preserved
+	ASSERT_EQ(local_agent.get(), local_agent_ptr);
+	ASSERT_FLOAT_EQ(
+			dynamic_cast<CustomAgent*>(local_agent.get())->getData(), 8.7f);
+}
+
 // LightObjectPack with default constructible agent (no explicit
 // LightSerializer specialization)
 TEST(AgentSerializer, light_object_pack_default_constructible) {
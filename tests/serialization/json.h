@@ -99,6 +99,24 @@ TEST(AgentSerializer, json) {
 	ASSERT_THAT(agent_ptr_12->groupIds(), UnorderedElementsAre(4, 90));
 }
 
+TEST(AgentSerializer, json_type_id) {
+	fpmas::api::model::AgentPtr agent_ptr {new MockAgent<12>(3)};
+
+	nlohmann::json j = agent_ptr;
+
+	FPMAS_TYPE_INDEX type_id;
+	ASSERT_TRUE(nlohmann::adl_serializer<std::type_index>::find_id(
+				MockAgent<12>::TYPE_ID, type_id));
+	ASSERT_EQ(j["type"].get<FPMAS_TYPE_INDEX>(), type_id);
+}
+
+TEST(AgentSerializer, json_unregistered_type) {
+	fpmas::api::model::AgentPtr agent_ptr {new MockAgent<1>};
+
+	nlohmann::json j;
+	ASSERT_THROW(j = agent_ptr, fpmas::exceptions::BadTypeException);
+}
+
 // light_json with default constructible agent (no explicit light_serializer
 // specialization)
 TEST(AgentSerializer, light_json_default_constructible) {